@@ -13,6 +13,7 @@ Edu Meneses (2022) - https://www.edumeneses.com
 */
 
 #include <puara.h>
+#include "puara_assets.h"
 
 // Defining static members
 std::string Puara::dmiName;
@@ -30,6 +31,7 @@ std::string Puara::oscIP1;
 unsigned int Puara::oscPORT1;
 std::string Puara::oscIP2;
 unsigned int Puara::oscPORT2;
+std::string Puara::oscDestinations;
 unsigned int Puara::localPORT;
 std::string Puara::wifiAvailableSsid;
 std::string Puara::currentSSID;
@@ -46,11 +48,89 @@ std::unordered_map<std::string,int> Puara::config_fields = {
     {"password",8},
     {"reboot",9},
     {"persistentAP",10},
-    {"localPORT",11}
+    {"localPORT",11},
+    {"oscDestinations",12}
 };
 
-std::vector<Puara::settingsVariables> Puara::variables;
-std::unordered_map<std::string,int> Puara::variables_fields;
+std::atomic<const Puara::settingsSnapshot*> Puara::settings_current(new Puara::settingsSnapshot());
+std::atomic<unsigned int> Puara::settings_epoch(0);
+std::atomic<int> Puara::settings_readers[2];
+std::mutex Puara::settings_write_mutex;
+std::mutex Puara::persistence_mutex;
+std::mutex Puara::config_mutex;
+uint32_t Puara::config_record_crc = 0;
+bool Puara::config_record_valid = false;
+uint32_t Puara::settings_record_crc = 0;
+bool Puara::settings_record_valid = false;
+std::atomic<bool> Puara::config_dirty(false);
+std::atomic<bool> Puara::settings_dirty(false);
+TaskHandle_t Puara::persistence_task = NULL;
+std::atomic<bool> Puara::flush_requested(false);
+TaskHandle_t Puara::flush_waiter = NULL;
+bool Puara::nvs_initialized = false;
+Puara::oscDestination Puara::osc_destinations[PUARA_OSC_DESTINATIONS];
+std::atomic<int> Puara::osc_shed_priority(0);
+std::atomic<int64_t> Puara::osc_shed_us(0);
+std::atomic<int64_t> Puara::osc_failure_us(0);
+std::atomic<uint32_t> Puara::osc_dropped(0);
+std::mutex Puara::osc_mutex;
+std::atomic<bool> Puara::osc_bundling(false);
+unsigned int Puara::osc_bundle_deadline_ms = PUARA_OSC_BUNDLE_DEADLINE_MS;
+esp_timer_handle_t Puara::osc_bundle_timer = nullptr;
+std::atomic<uint32_t> Puara::osc_messages(0);
+std::atomic<uint32_t> Puara::osc_packets(0);
+std::atomic<uint32_t> Puara::osc_bytes(0);
+std::vector<Puara::oscNode> Puara::osc_nodes(1);
+std::mutex Puara::osc_nodes_mutex;
+int Puara::osc_receive_socket = -1;
+TaskHandle_t Puara::osc_receiver = NULL;
+unsigned int Puara::osc_settings_layout = ~0u;
+std::vector<std::unique_ptr<std::string>> Puara::osc_setting_names;
+std::vector<Puara::oscSettingWrite> Puara::osc_setting_writes;
+#ifdef PUARA_BOOT_PROFILE
+Puara::bootPhase Puara::boot_phases[PUARA_BOOT_PHASES];
+std::atomic<size_t> Puara::boot_phase_count(0);
+httpd_uri_t Puara::apimetrics;
+#endif
+Puara::settingsCallback Puara::settings_subscribers[PUARA_SETTINGS_SUBSCRIBERS];
+std::mutex Puara::settings_subscribers_mutex;
+std::vector<std::string> Puara::settings_pending;
+std::mutex Puara::settings_pending_mutex;
+TaskHandle_t Puara::settings_notifier = NULL;
+
+std::unordered_map<std::string,int> Puara::template_fields = {
+    {"DMINAME", TEMPLATE_DMINAME},
+    {"STATUS", TEMPLATE_STATUS},
+    {"CURRENTSSID", TEMPLATE_CURRENTSSID},
+    {"CURRENTPSK", TEMPLATE_CURRENTPSK},
+    {"CURRENTPERSISTENT", TEMPLATE_CURRENTPERSISTENT},
+    {"DEVICENAME", TEMPLATE_DEVICENAME},
+    {"CURRENTOSC1", TEMPLATE_CURRENTOSC1},
+    {"CURRENTPORT1", TEMPLATE_CURRENTPORT1},
+    {"CURRENTOSC2", TEMPLATE_CURRENTOSC2},
+    {"CURRENTPORT2", TEMPLATE_CURRENTPORT2},
+    {"CURRENTLOCALPORT", TEMPLATE_CURRENTLOCALPORT},
+    {"CURRENTDESTINATIONS", TEMPLATE_CURRENTDESTINATIONS},
+    {"CURRENTSSID2", TEMPLATE_CURRENTSSID2},
+    {"CURRENTIP", TEMPLATE_CURRENTIP},
+    {"CURRENTAPIP", TEMPLATE_CURRENTAPIP},
+    {"CURRENTSTAMAC", TEMPLATE_CURRENTSTAMAC},
+    {"CURRENTAPMAC", TEMPLATE_CURRENTAPMAC},
+    {"MODULEID", TEMPLATE_MODULEID},
+    {"MODULEAUTH", TEMPLATE_MODULEAUTH},
+    {"MODULEINST", TEMPLATE_MODULEINST},
+    {"MODULEVER", TEMPLATE_MODULEVER},
+    {"SSIDS", TEMPLATE_SSIDS},
+    {"DATAFROMMODULE", TEMPLATE_DATAFROMMODULE},
+    {"PARAMETER", TEMPLATE_PARAMETER},
+    {"PARAMETERVALUE", TEMPLATE_PARAMETERVALUE}
+};
+Puara::pageTemplate Puara::index_template;
+Puara::pageTemplate Puara::settings_template;
+Puara::pageTemplate Puara::scan_template;
+Puara::pageTemplate Puara::settings_text_row;
+Puara::pageTemplate Puara::settings_number_row;
+char Puara::response_buffer[PUARA_HTTP_CHUNK_SIZE];
 
 std::string Puara::currentSTA_IP;
 std::string Puara::currentSTA_MAC;
@@ -60,6 +140,12 @@ bool Puara::StaIsConnected = false;
 bool Puara::ApStarted = false;
 
 esp_vfs_spiffs_conf_t Puara::spiffs_config;
+std::unordered_map<std::string,Puara::cachedAsset> Puara::asset_cache;
+size_t Puara::asset_cache_size = 0;
+unsigned int Puara::asset_cache_clock = 0;
+std::mutex Puara::asset_cache_mutex;
+std::atomic<unsigned int> Puara::config_generation(0);
+const char* Puara::static_cache_control = "public, max-age=" PUARA_STRINGIFY(PUARA_HTTP_MAX_AGE);
 std::string Puara::spiffs_base_path;
 EventGroupHandle_t Puara::s_wifi_event_group;
 wifi_config_t Puara::wifi_config_sta;
@@ -76,11 +162,54 @@ httpd_uri_t Puara::scan;
 httpd_uri_t Puara::indexpost;
 httpd_uri_t Puara::settings;
 httpd_uri_t Puara::settingspost;
+httpd_uri_t Puara::apiconfig;
+httpd_uri_t Puara::apiconfigput;
+httpd_uri_t Puara::apiconfigpatch;
+httpd_uri_t Puara::apisettings;
+httpd_uri_t Puara::apisettingsput;
+httpd_uri_t Puara::apisettingspatch;
 
 char Puara::serial_data[PUARA_SERIAL_BUFSIZE];
-int Puara::serial_data_length;
-std::string Puara::serial_data_str;
-std::string Puara::serial_data_str_buffer;
+Puara::serialRing Puara::serial_ring;
+Puara::serialFrame Puara::serial_frame;
+Puara::serialTransfer Puara::serial_transfer;
+TaskHandle_t Puara::serial_interpreter = NULL;
+constexpr Puara::serialCommand Puara::serial_commands[] = {
+    {"reset", Puara::reboot_command},
+    {"reboot", Puara::reboot_command},
+    {"ping", Puara::ping_command},
+    {"whatareyou", Puara::whatareyou_command},
+    {"sendconfig", Puara::sendconfig_command},
+    {"writeconfig", Puara::writeconfig_command},
+    {"readconfig", Puara::readconfig_command},
+    {"sendsettings", Puara::sendsettings_command},
+    {"writesettings", Puara::writesettings_command},
+    {"readsettings", Puara::readsettings_command},
+#ifdef PUARA_BOOT_PROFILE
+    {"bootprofile", Puara::bootprofile_command},
+#endif
+};
+const size_t Puara::serial_commands_count = sizeof(serial_commands) / sizeof(serial_commands[0]);
+constexpr Puara::configKey Puara::config_keys[] = {
+    {"device", false, false},
+    {"id", true, false},
+    {"author", false, false},
+    {"institution", false, false},
+    {"APpasswd", false, true},
+    {"wifiSSID", false, false},
+    {"wifiPSK", false, true},
+    {"persistentAP", true, false},
+    {"oscIP1", false, false},
+    {"oscPORT1", true, false},
+    {"oscIP2", false, false},
+    {"oscPORT2", true, false},
+    {"localPORT", true, false},
+    {"oscDestinations", false, false}
+};
+const size_t Puara::config_keys_count = sizeof(config_keys) / sizeof(config_keys[0]);
+Puara::serialCommand Puara::user_commands[PUARA_SERIAL_USER_COMMANDS];
+std::atomic<size_t> Puara::user_commands_count(0);
+std::mutex Puara::user_commands_mutex;
 int Puara::module_monitor = UART_MONITOR;
 const std::string Puara::data_start = "<<<";
 const std::string Puara::data_end = ">>>";
@@ -91,9 +220,14 @@ unsigned int Puara::get_version() {
 
 void Puara::set_version(unsigned int user_version) {
     version = user_version;
+    config_generation++;
 };
 
 void Puara::start(Monitors monitor) {
+    PUARA_BOOT_PHASE("reset");
+    // a per-boot start keeps a browser from revalidating a page rendered
+    // before a reboot against the same generation
+    config_generation = esp_random();
     std::cout 
     << "\n"
     << "**********************************************************\n"
@@ -105,13 +239,25 @@ void Puara::start(Monitors monitor) {
     << "**********************************************************\n"
     << std::endl;
     
-    config_spiffs();    
-    read_config_json();
-    read_settings_json();
+    config_spiffs();
+    PUARA_BOOT_PHASE("config_spiffs");
+    mount_spiffs();
+    PUARA_BOOT_PHASE("mount_spiffs");
+    read_config();
+    PUARA_BOOT_PHASE("read_config");
+    read_settings();
+    PUARA_BOOT_PHASE("read_settings");
+    xTaskCreate(persist_changes, "persist_changes", 4096, NULL, tskIDLE_PRIORITY+2, &persistence_task);
     start_wifi();
+    PUARA_BOOT_PHASE("start_wifi");
     start_webserver();
+    PUARA_BOOT_PHASE("start_webserver");
+    start_osc_receiver();
+    PUARA_BOOT_PHASE("start_osc_receiver");
     start_mdns_service(dmiName, dmiName);
+    PUARA_BOOT_PHASE("start_mdns_service");
     wifi_scan();
+    PUARA_BOOT_PHASE("wifi_scan");
 
     module_monitor = monitor;
     
@@ -122,9 +268,57 @@ void Puara::start(Monitors monitor) {
     };
     vTaskDelay(50 / portTICK_RATE_MS);
     std::cout << "serial listening ready" << std::endl;
+    PUARA_BOOT_PHASE("serial");
     
     std::cout << "Puara Start Done!\n\n  Type \"reboot\" in the serial monitor to reset the ESP32.\n\n";
+#ifdef PUARA_BOOT_PROFILE
+    report_boot_profile();
+#endif
+}
+
+#ifdef PUARA_BOOT_PROFILE
+void Puara::boot_phase(const char* name) {
+    size_t count = boot_phase_count.load(std::memory_order_relaxed);
+    if (count == PUARA_BOOT_PHASES) {
+        return;
+    }
+    boot_phases[count] = {name, esp_timer_get_time()};
+    // readers only look at entries below the published count
+    boot_phase_count.store(count + 1, std::memory_order_release);
+}
+
+void Puara::report_boot_profile() {
+    size_t count = boot_phase_count.load(std::memory_order_acquire);
+    printf("boot: %-20s %10s %10s\n", "phase", "at (ms)", "took (ms)");
+    int64_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        printf("boot: %-20s %10.1f %10.1f\n", boot_phases[i].name, 
+               boot_phases[i].end_us / 1000.0, (boot_phases[i].end_us - previous) / 1000.0);
+        previous = boot_phases[i].end_us;
+    }
+}
+
+void Puara::bootprofile_command(std::string_view /* arguments */) {
+    Puara::report_boot_profile();
+}
+
+esp_err_t Puara::api_metrics_get_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
+    responseStream stream = {req, 0, ESP_OK};
+    size_t count = boot_phase_count.load(std::memory_order_acquire);
+    int64_t previous = 0;
+    stream_write(stream, "{\"boot\":[");
+    for (size_t i = 0; i < count; i++) {
+        stream_write(stream, i == 0 ? "{\"phase\":" : ",{\"phase\":");
+        stream_json_string(stream, boot_phases[i].name);
+        stream_printf(stream, ",\"at_us\":%lld", (long long) boot_phases[i].end_us);
+        stream_printf(stream, ",\"took_us\":%lld}", (long long) (boot_phases[i].end_us - previous));
+        previous = boot_phases[i].end_us;
+    }
+    stream_write(stream, "]}");
+    return stream_finish(stream);
 }
+#endif
 
 void Puara::sta_event_handler(void* arg, esp_event_base_t event_base, 
                                int event_id, void* event_data) {
@@ -152,6 +346,7 @@ void Puara::sta_event_handler(void* arg, esp_event_base_t event_base,
         tempBuf << esp_ip4_addr4_16(&event->ip_info.ip);
         Puara::currentSTA_IP = tempBuf.str();
         std::cout << "wifi/sta_event_handler: got ip:" << Puara::currentSTA_IP << std::endl;
+        Puara::config_generation++;
         Puara::connect_counter = 0;
         xEventGroupSetBits(s_wifi_event_group, Puara::wifi_connected_bit);
     }
@@ -280,6 +475,7 @@ void Puara::wifi_init() {
     tempBuf << std::dec << esp_ip4_addr3_16(&ip_temp_info.ip) << ".";
     tempBuf << std::dec << esp_ip4_addr4_16(&ip_temp_info.ip);
     Puara::currentAP_IP = tempBuf.str();
+    Puara::config_generation++;
 }
 
 void Puara::start_wifi() {
@@ -319,13 +515,7 @@ void Puara::start_wifi() {
     Puara::wifi_config_ap.ap.max_connection = Puara::max_connection;
     Puara::wifi_config_ap.ap.authmode = WIFI_AUTH_WPA_WPA2_PSK;
 
-    //Initialize NVS
-        esp_err_t ret = nvs_flash_init();
-        if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-            ESP_ERROR_CHECK(nvs_flash_erase());
-            ret = nvs_flash_init();
-        }
-        ESP_ERROR_CHECK(ret);
+    Puara::init_nvs();
 
     std::cout << "startWifi: Starting WiFi config" << std::endl;
     Puara::connect_counter = 0;
@@ -384,70 +574,114 @@ void Puara::unmount_spiffs() {
     }
 }
 
-void Puara::read_config_json() { // Deserialize
-    
-    std::cout << "json: Mounting FS" << std::endl;
-    Puara::mount_spiffs();
+std::shared_ptr<const std::string> Puara::get_asset(const std::string& path) {
+    std::lock_guard<std::mutex> lock(asset_cache_mutex);
+    asset_cache_clock++;
 
-    std::cout << "json: Opening config json file" << std::endl;
-    FILE* f = fopen("/spiffs/config.json", "r");
-    if (f == NULL) {
-        std::cout << "json: Failed to open file" << std::endl;
-        return;
+    auto cached = asset_cache.find(path);
+    if (cached != asset_cache.end()) {
+        cached->second.last_used = asset_cache_clock;
+        return cached->second.contents;
     }
 
-    std::cout << "json: Reading json file" << std::endl;
-    std::ifstream in("/spiffs/config.json");
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
-
-    Puara::read_config_json_internal(contents);
+    Puara::mount_spiffs();
+    std::cout << "spiffs: Loading " << path << std::endl;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return nullptr;
+    }
+    std::shared_ptr<const std::string> contents = std::make_shared<const std::string>(
+        (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // Evict least recently used files to keep the cache under its budget.
+    // Handlers still holding an evicted file keep it alive until they are done.
+    while (!asset_cache.empty() && 
+           asset_cache_size + contents->length() > PUARA_ASSET_CACHE_SIZE) {
+        auto oldest = asset_cache.begin();
+        for (auto it = asset_cache.begin(); it != asset_cache.end(); ++it) {
+            if (it->second.last_used < oldest->second.last_used) {
+                oldest = it;
+            }
+        }
+        asset_cache_size -= oldest->second.contents->length();
+        asset_cache.erase(oldest);
+    }
+    asset_cache.insert({path, {contents, asset_cache_clock}});
+    asset_cache_size += contents->length();
 
-    fclose(f);
-    Puara::unmount_spiffs();
+    return contents;
 }
 
-void Puara::read_config_json_internal(std::string& contents) {
-    std::cout << "json: Getting data" << std::endl;
-    cJSON *root = cJSON_Parse(contents.c_str());
-    if (cJSON_GetObjectItem(root, "device")) {
-        Puara::device = cJSON_GetObjectItem(root,"device")->valuestring;
-    }
-    if (cJSON_GetObjectItem(root, "id")) {
-        Puara::id = cJSON_GetObjectItem(root,"id")->valueint;
-    }
-    if (cJSON_GetObjectItem(root, "author")) {
-        Puara::author = cJSON_GetObjectItem(root,"author")->valuestring;
-    }
-    if (cJSON_GetObjectItem(root, "institution")) {
-        Puara::institution = cJSON_GetObjectItem(root,"institution")->valuestring;
-    }
-    if (cJSON_GetObjectItem(root, "APpasswd")) {
-        Puara::APpasswd = cJSON_GetObjectItem(root,"APpasswd")->valuestring;
-    }
-    if (cJSON_GetObjectItem(root, "wifiSSID")) {
-        Puara::wifiSSID = cJSON_GetObjectItem(root,"wifiSSID")->valuestring;
-    }
-    if (cJSON_GetObjectItem(root, "wifiPSK")) {
-        Puara::wifiPSK = cJSON_GetObjectItem(root,"wifiPSK")->valuestring;
-    }
-    if (cJSON_GetObjectItem(root, "persistentAP")) {
-        Puara::persistentAP = cJSON_GetObjectItem(root,"persistentAP")->valueint;
+void Puara::invalidate_asset(const std::string& path) {
+    std::lock_guard<std::mutex> lock(asset_cache_mutex);
+    auto cached = asset_cache.find(path);
+    if (cached != asset_cache.end()) {
+        asset_cache_size -= cached->second.contents->length();
+        asset_cache.erase(cached);
     }
-    if (cJSON_GetObjectItem(root, "oscIP1")) {
-        Puara::oscIP1 = cJSON_GetObjectItem(root,"oscIP1")->valuestring;
+}
+
+void Puara::read_config_json() { // Deserialize
+    
+    std::cout << "json: Reading config json file" << std::endl;
+    std::shared_ptr<const std::string> file = Puara::get_asset("/spiffs/config.json");
+    if (!file) {
+        // written but not renamed yet
+        file = Puara::get_asset("/spiffs/config.json.new");
     }
-    if (cJSON_GetObjectItem(root, "oscPORT1")) {
-        Puara::oscPORT1 = cJSON_GetObjectItem(root,"oscPORT1")->valueint;
+    if (!file) {
+        std::cout << "json: Failed to open file" << std::endl;
+        return;
     }
-    if (cJSON_GetObjectItem(root, "oscIP2")) {
-        Puara::oscIP2 = cJSON_GetObjectItem(root,"oscIP2")->valuestring;
+
+    Puara::read_config_json_internal(*file);
+}
+
+void Puara::read_config_json_internal(std::string_view contents) {
+    std::cout << "json: Getting data" << std::endl;
+    jsonCollector collector;
+    if (!Puara::parse_json(contents, collector, false)) {
+        std::cout << "json: Failed to parse config, keeping the current values" << std::endl;
+        return;
     }
-    if (cJSON_GetObjectItem(root, "oscPORT2")) {
-        Puara::oscPORT2 = cJSON_GetObjectItem(root,"oscPORT2")->valueint;
+    for (const auto& name : collector.too_long) {
+        std::cout << "json: Config field " << name << " too long, skipped" << std::endl;
     }
-    if (cJSON_GetObjectItem(root, "localPORT")) {
-        Puara::localPORT = cJSON_GetObjectItem(root,"localPORT")->valueint;
+    Puara::apply_config_fields(collector.fields);
+}
+
+void Puara::apply_config_fields(const std::vector<jsonField>& fields) {
+    std::lock_guard<std::mutex> lock(config_mutex);
+    for (const auto& field : fields) {
+        if (field.name == "device") {
+            Puara::device = field.text;
+        } else if (field.name == "id" && field.is_number) {
+            Puara::id = field.number;
+        } else if (field.name == "author") {
+            Puara::author = field.text;
+        } else if (field.name == "institution") {
+            Puara::institution = field.text;
+        } else if (field.name == "APpasswd") {
+            Puara::APpasswd = field.text;
+        } else if (field.name == "wifiSSID") {
+            Puara::wifiSSID = field.text;
+        } else if (field.name == "wifiPSK") {
+            Puara::wifiPSK = field.text;
+        } else if (field.name == "persistentAP" && field.is_number) {
+            Puara::persistentAP = field.number;
+        } else if (field.name == "oscIP1") {
+            Puara::oscIP1 = field.text;
+        } else if (field.name == "oscPORT1" && field.is_number) {
+            Puara::oscPORT1 = field.number;
+        } else if (field.name == "oscIP2") {
+            Puara::oscIP2 = field.text;
+        } else if (field.name == "oscPORT2" && field.is_number) {
+            Puara::oscPORT2 = field.number;
+        } else if (field.name == "localPORT" && field.is_number) {
+            Puara::localPORT = field.number;
+        } else if (field.name == "oscDestinations") {
+            Puara::oscDestinations = field.text;
+        }
     }
     
     std::cout << "\njson: Data collected:\n\n"
@@ -464,1054 +698,3658 @@ void Puara::read_config_json_internal(std::string& contents) {
     << "oscIP2: " << oscIP2 << "\n"
     << "oscPORT2: " << oscPORT2 << "\n"
     << "localPORT: " << localPORT << "\n"
+    << "oscDestinations: " << oscDestinations << "\n"
     << std::endl;
-    
-    cJSON_Delete(root);
 
     std::stringstream tempBuf;
     tempBuf << Puara::device << "_" << std::setfill('0') << std::setw(3) << Puara::id;
     Puara::dmiName = tempBuf.str();
     printf("Device unique name defined: %s\n",dmiName.c_str());
+    Puara::config_generation++;
+    Puara::resolve_osc_destinations();
 }
 
 void Puara::read_settings_json() {
 
-    std::cout << "json: Mounting FS" << std::endl;
-    Puara::mount_spiffs();
-
-    std::cout << "json: Opening settings json file" << std::endl;
-    FILE* f = fopen("/spiffs/settings.json", "r");
-    if (f == NULL) {
+    std::cout << "json: Reading settings json file" << std::endl;
+    std::shared_ptr<const std::string> file = Puara::get_asset("/spiffs/settings.json");
+    if (!file) {
+        // written but not renamed yet
+        file = Puara::get_asset("/spiffs/settings.json.new");
+    }
+    if (!file) {
         std::cout << "json: Failed to open file" << std::endl;
         return;
     }
 
-    std::cout << "json: Reading json file" << std::endl;
-    std::ifstream in("/spiffs/settings.json");
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
-
-    Puara::read_settings_json_internal(contents);
-    fclose(f);
-    Puara::unmount_spiffs();
+    Puara::read_settings_json_internal(*file);
 }
 
-void Puara::read_settings_json_internal(std::string& contents, bool merge) {
+void Puara::read_settings_json_internal(std::string_view contents, bool merge) {
     std::cout << "json: Getting data" << std::endl;
-    cJSON *root = cJSON_Parse(contents.c_str());
-    cJSON *setting = NULL;
-    cJSON *settings = NULL;
-
-    std::cout << "json: Parse settings information" << std::endl;
-    settings = cJSON_GetObjectItemCaseSensitive(root, "settings");
-   
-    settingsVariables temp;
+    jsonCollector collector;
+    if (!Puara::parse_json(contents, collector, true)) {
+        std::cout << "json: Failed to parse settings, keeping the current values" << std::endl;
+        return;
+    }
+    for (const auto& name : collector.too_long) {
+        std::cout << "json: Setting " << name << " too long, skipped" << std::endl;
+    }
+    Puara::apply_settings_fields(collector.fields, merge);
+}
+
+void Puara::settingsStore::clear() {
+    types.clear();
+    numbers.clear();
+    names.clear();
+    texts.clear();
+    name_arena.clear();
+    text_arena.clear();
+    text_garbage = 0;
+    name_index.clear();
+}
+
+int Puara::settingsStore::find(std::string_view name) const {
+    auto it = std::lower_bound(name_index.begin(), name_index.end(), name, 
+                               [this](uint32_t index, std::string_view key) { return this->name(index) < key; });
+    if (it == name_index.end() || this->name(*it) != name) {
+        return -1;
+    }
+    return *it;
+}
+
+size_t Puara::settingsStore::add(std::string_view name, settingType type) {
+    auto position = std::lower_bound(name_index.begin(), name_index.end(), name, 
+                                     [this](uint32_t index, std::string_view key) { return this->name(index) < key; });
+    name_index.insert(position, static_cast<uint32_t>(types.size()));
+    names.push_back({static_cast<uint32_t>(name_arena.size()), static_cast<uint32_t>(name.size())});
+    name_arena.append(name);
+    texts.push_back({static_cast<uint32_t>(text_arena.size()), 0});
+    types.push_back(type);
+    numbers.push_back(0);
+    return types.size() - 1;
+}
+
+void Puara::settingsStore::set_text(size_t index, std::string_view value) {
+    arenaSpan& span = texts[index];
+    if (value.size() <= span.length) {
+        // shrinking values are rewritten in place
+        text_arena.replace(span.offset, value.size(), value);
+        text_garbage += span.length - value.size();
+        span.length = value.size();
+        return;
+    }
+    text_garbage += span.length;
+    span = {static_cast<uint32_t>(text_arena.size()), static_cast<uint32_t>(value.size())};
+    text_arena.append(value);
+    if (text_garbage > text_arena.size() / 2) {
+        // compact once more than half of the arena is stale
+        std::string compacted;
+        compacted.reserve(text_arena.size() - text_garbage);
+        for (auto& it : texts) {
+            uint32_t offset = compacted.size();
+            compacted.append(text_arena, it.offset, it.length);
+            it.offset = offset;
+        }
+        text_arena.swap(compacted);
+        text_garbage = 0;
+    }
+}
+
+void Puara::apply_settings_fields(const std::vector<jsonField>& fields, bool merge) {
+    std::lock_guard<std::mutex> lock(settings_write_mutex);
+    std::unique_ptr<settingsSnapshot> next = copy_settings();
+    settingsStore& variables = next->variables;
+    bool layout_changed = !merge;
     if (!merge) {
         variables.clear();
     }
     std::cout << "json: Extract info" << std::endl;
-    cJSON_ArrayForEach(setting, settings) {
-        cJSON *name = cJSON_GetObjectItemCaseSensitive(setting, "name");
-        cJSON *value = cJSON_GetObjectItemCaseSensitive(setting, "value");
-        temp.name = name->valuestring;
-        if (!cJSON_IsNumber(value)) {
-            temp.textValue = value->valuestring;
-            temp.type = "text";
-            temp.numberValue = 0;
-        } else {
-            temp.textValue.empty();
-            temp.numberValue = value->valuedouble;
-            temp.type = "number";
+    for (const auto& field : fields) {
+        settingType type = field.is_number ? SETTING_NUMBER : SETTING_TEXT;
+        int index = variables.find(field.name);
+        if (index < 0) {
+            index = variables.add(field.name, type);
+            layout_changed = true;
+        } else if (variables.types[index] != type) {
+            variables.types[index] = type;
+            layout_changed = true;
         }
-        if (variables_fields.find(temp.name) == variables_fields.end()) {
-            variables_fields.insert({temp.name, variables.size()});
-            variables.push_back(temp);
+        if (type == SETTING_NUMBER) {
+            variables.numbers[index] = field.number;
+            variables.set_text(index, std::string_view());
         } else {
-            int variable_index = variables_fields.at(temp.name);
-            variables.at(variable_index) = temp;
+            variables.numbers[index] = 0;
+            variables.set_text(index, field.text);
         }
     }
 
     // Print acquired data
     std::cout << "\nModule-specific settings:\n\n";
-    for (auto it : variables) {
-        std::cout << it.name << ": ";
-        if (it.type == "text") {
-            std::cout << it.textValue << "\n";
-        } else if (it.type == "number") {
-            std::cout << it.numberValue << "\n";
+    for (size_t i = 0; i < variables.size(); i++) {
+        std::cout << variables.name(i) << ": ";
+        if (variables.types[i] == SETTING_TEXT) {
+            std::cout << variables.text(i) << "\n";
+        } else {
+            std::cout << variables.numbers[i] << "\n";
         }
     }
     std::cout << std::endl;
-    
-    cJSON_Delete(root);
+    Puara::publish_settings(std::move(next), layout_changed);
+    Puara::config_generation++;
 }
 
-
-void Puara::write_config_json() {
-    
-    std::cout << "SPIFFS: Mounting FS" << std::endl;
-    Puara::mount_spiffs();
-
-    std::cout << "SPIFFS: Opening config.json file" << std::endl;
-    FILE* f = fopen("/spiffs/config.json", "w");
-    if (f == NULL) {
-        std::cout << "SPIFFS: Failed to open config.json file" << std::endl;
-        return;
+Puara::settingsReadGuard::settingsReadGuard() {
+    // Register in the current epoch; retry if a writer moved on meanwhile so
+    // the writer never misses a reader that can see the old snapshot
+    while (true) {
+        epoch = settings_epoch.load();
+        settings_readers[epoch & 1]++;
+        if (settings_epoch.load() == epoch) {
+            break;
+        }
+        settings_readers[epoch & 1]--;
     }
+    snapshot = settings_current.load();
+}
 
-    cJSON *device_json = NULL;
-    cJSON *id_json = NULL;
-    cJSON *author_json = NULL;
-    cJSON *institution_json = NULL;
-    cJSON *APpasswd_json = NULL;
-    cJSON *wifiSSID_json = NULL;
-    cJSON *wifiPSK_json = NULL;
-    cJSON *persistentAP_json = NULL;
-    cJSON *oscIP1_json = NULL;
-    cJSON *oscPORT1_json = NULL;
-    cJSON *oscIP2_json = NULL;
-    cJSON *oscPORT2_json = NULL;
-    cJSON *localPORT_json = NULL;
-
-    cJSON *root = cJSON_CreateObject();
-
-    device_json = cJSON_CreateString(device.c_str());
-    cJSON_AddItemToObject(root, "device", device_json);
-    
-    id_json = cJSON_CreateNumber(id);
-    cJSON_AddItemToObject(root, "id", id_json);
-    
-    author_json = cJSON_CreateString(author.c_str());
-    cJSON_AddItemToObject(root, "author", author_json);
-    
-    institution_json = cJSON_CreateString(institution.c_str());
-    cJSON_AddItemToObject(root, "institution", institution_json);
-    
-    APpasswd_json = cJSON_CreateString(APpasswd.c_str());
-    cJSON_AddItemToObject(root, "APpasswd", APpasswd_json);
-    
-    wifiSSID_json = cJSON_CreateString(wifiSSID.c_str());
-    cJSON_AddItemToObject(root, "wifiSSID", wifiSSID_json);
-    
-    wifiPSK_json = cJSON_CreateString(wifiPSK.c_str());
-    cJSON_AddItemToObject(root, "wifiPSK", wifiPSK_json);
-
-    persistentAP_json = cJSON_CreateNumber(persistentAP);
-    cJSON_AddItemToObject(root, "persistentAP", persistentAP_json);
-    
-    oscIP1_json = cJSON_CreateString(oscIP1.c_str());
-    cJSON_AddItemToObject(root, "oscIP1", oscIP1_json);
-    
-    oscPORT1_json = cJSON_CreateNumber(oscPORT1);
-    cJSON_AddItemToObject(root, "oscPORT1", oscPORT1_json);
-    
-    oscIP2_json = cJSON_CreateString(oscIP2.c_str());
-    cJSON_AddItemToObject(root, "oscIP2", oscIP2_json);
-    
-    oscPORT2_json = cJSON_CreateNumber(oscPORT2);
-    cJSON_AddItemToObject(root, "oscPORT2", oscPORT2_json);
-    
-    localPORT_json = cJSON_CreateNumber(localPORT);
-    cJSON_AddItemToObject(root, "localPORT", localPORT_json);
-
-    std::cout << "\njson: Data stored:\n"
-    << "\ndevice: " << device << "\n"
-    << "id: " << id << "\n"
-    << "author: " << author << "\n"
-    << "institution: " << institution << "\n"
-    << "APpasswd: " << APpasswd << "\n"
-    << "wifiSSID: " << wifiSSID << "\n"
-    << "wifiPSK: " << wifiPSK << "\n"
-    << "persistentAP: " << persistentAP << "\n"
-    << "oscIP1: " << oscIP1 << "\n"
-    << "oscPORT1: " << oscPORT1 << "\n"
-    << "oscIP2: " << oscIP2 << "\n"
-    << "oscPORT2: " << oscPORT2 << "\n"
-    << "localPORT: " << localPORT << "\n"
-    << std::endl;
-
-    // Save to config.json
-    std::cout << "write_config_json: Serializing json" << std::endl;
-    std::string contents = cJSON_Print(root);
-    std::cout << "SPIFFS: Saving file" << std::endl;
-    fprintf(f, "%s", contents.c_str());
-    std::cout << "SPIFFS: closing" << std::endl;
-    fclose(f);
-
-    std::cout << "write_config_json: Delete json entity" << std::endl;
-    cJSON_Delete(root);
+Puara::settingsReadGuard::~settingsReadGuard() {
+    settings_readers[epoch & 1]--;
+}
 
-    std::cout << "SPIFFS: umounting FS" << std::endl;
-    Puara::unmount_spiffs();
+std::unique_ptr<Puara::settingsSnapshot> Puara::copy_settings() {
+    return std::unique_ptr<settingsSnapshot>(new settingsSnapshot(*settings_current.load()));
 }
 
-void Puara::write_settings_json() {
-    
-    std::cout << "SPIFFS: Mounting FS" << std::endl;
-    Puara::mount_spiffs();
+void Puara::publish_settings(std::unique_ptr<settingsSnapshot> next, bool layout_changed) {
+    const settingsSnapshot* previous = settings_current.load();
+    next->version = previous->version + 1;
+    if (layout_changed) {
+        next->layout = previous->layout + 1;
+    }
+    if (settings_notifier != NULL) {
+        queue_settings_changes(*previous, *next);
+    }
+    settings_current.store(next.release());
 
-    std::cout << "SPIFFS: Opening settings.json file" << std::endl;
-    FILE* f = fopen("/spiffs/settings.json", "w");
-    if (f == NULL) {
-        std::cout << "SPIFFS: Failed to open settings.json file" << std::endl;
-        return;
+    // Readers that registered before the epoch flip may still hold previous
+    unsigned int epoch = settings_epoch.load();
+    settings_epoch.store(epoch + 1);
+    while (settings_readers[epoch & 1].load() != 0) {
+        vTaskDelay(1);
     }
+    delete previous;
+}
 
-    cJSON *root = cJSON_CreateObject();
-    cJSON *settings = cJSON_CreateArray();
-    cJSON *setting = NULL;
-    cJSON *data = NULL;
-    cJSON_AddItemToObject(root, "settings", settings);
+void Puara::queue_settings_changes(const settingsSnapshot& previous, const settingsSnapshot& next) {
+    std::lock_guard<std::mutex> lock(settings_pending_mutex);
+    size_t pending = settings_pending.size();
+    auto add = [](std::string_view name) {
+        if (std::find(settings_pending.begin(), settings_pending.end(), name) == settings_pending.end()) {
+            settings_pending.emplace_back(name);
+        }
+    };
+    const settingsStore& before = previous.variables;
+    const settingsStore& after = next.variables;
+    for (size_t i = 0; i < after.size(); i++) {
+        int j = before.find(after.name(i));
+        if (j < 0) {
+            add(after.name(i));
+            continue;
+        }
+        if (before.types[j] != after.types[i] || before.numbers[j] != after.numbers[i] ||
+            before.text(j) != after.text(i)) {
+            add(after.name(i));
+        }
+    }
+    for (size_t j = 0; j < before.size(); j++) {
+        if (after.find(before.name(j)) < 0) {
+            add(before.name(j));
+        }
+    }
+    if (settings_pending.size() != pending) {
+        xTaskNotifyGive(settings_notifier);
+    }
+}
 
-    for (auto it : variables) {
-        setting = cJSON_CreateObject();
-        cJSON_AddItemToArray(settings, setting);
-        data = cJSON_CreateString(it.name.c_str());
-        cJSON_AddItemToObject(setting, "name", data);
-        if (it.type == "text") {
-            data = cJSON_CreateString(it.textValue.c_str());
-        } else if (it.type == "number") {
-            data = cJSON_CreateNumber(it.numberValue);
+void Puara::notify_settings(void *arg) {
+    std::vector<std::string> changed;
+    settingsCallback subscribers[PUARA_SETTINGS_SUBSCRIBERS];
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        {
+            // everything queued since the last wake up goes out as one batch
+            std::lock_guard<std::mutex> lock(settings_pending_mutex);
+            changed.swap(settings_pending);
+        }
+        if (changed.empty()) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(settings_subscribers_mutex);
+            std::copy(settings_subscribers, settings_subscribers + PUARA_SETTINGS_SUBSCRIBERS, subscribers);
+        }
+        for (auto callback : subscribers) {
+            if (callback != nullptr) {
+                callback(changed);
+            }
         }
-        cJSON_AddItemToObject(setting, "value", data);
+        changed.clear();
     }
+}
 
-    // Save to settings.json
-    std::cout << "write_settings_json: Serializing json" << std::endl;
-    std::string contents = cJSON_Print(root);
-    std::cout << "SPIFFS: Saving file" << std::endl;
-    fprintf(f, "%s", contents.c_str());
-    std::cout << "SPIFFS: closing" << std::endl;
-    fclose(f);
+int Puara::subscribe_settings(void (*callback)(const std::vector<std::string>& changed_settings)) {
+    std::lock_guard<std::mutex> lock(settings_subscribers_mutex);
+    if (callback == nullptr) {
+        return -1;
+    }
+    for (int i = 0; i < PUARA_SETTINGS_SUBSCRIBERS; i++) {
+        if (settings_subscribers[i] == nullptr) {
+            settings_subscribers[i] = callback;
+            if (settings_notifier == NULL) {
+                xTaskCreate(notify_settings, "settings_notifier", 4096, NULL, tskIDLE_PRIORITY+1, &settings_notifier);
+            }
+            return i;
+        }
+    }
+    std::cout << "settings: Subscriber table full" << std::endl;
+    return -1;
+}
 
-    std::cout << "write_settings_json: Delete json entity" << std::endl;
-    cJSON_Delete(root);
+void Puara::unsubscribe_settings(int id) {
+    std::lock_guard<std::mutex> lock(settings_subscribers_mutex);
+    if (id >= 0 && id < PUARA_SETTINGS_SUBSCRIBERS) {
+        settings_subscribers[id] = nullptr;
+    }
+}
 
-    std::cout << "SPIFFS: umounting FS" << std::endl;
-    Puara::unmount_spiffs();
+bool Puara::parse_json(std::string_view contents, jsonCollector& collector, bool settings) {
+    jsonStream parser;
+    collector.in_settings = false;
+    collector.current_too_long = false;
+    parser.begin(settings ? collect_settings_field : collect_config_field, &collector);
+    parser.feed(contents.data(), contents.length());
+    return parser.finish();
 }
 
-std::string Puara::get_dmi_name() {
-    return dmiName;
+void Puara::collect_config_field(void* context, const jsonEvent& event) {
+    jsonCollector* collector = static_cast<jsonCollector*>(context);
+    // config.json is a flat object of strings and numbers
+    if (event.depth != 1 || event.key.empty()) {
+        return;
+    }
+    if (event.too_long) {
+        collector->too_long.emplace_back(event.key);
+    } else if (event.type == JSON_STRING || event.type == JSON_NUMBER) {
+        collector->fields.push_back({std::string(event.key), event.type == JSON_NUMBER, 
+                                     std::string(event.text), event.number});
+    } else if (event.type == JSON_TRUE || event.type == JSON_FALSE) {
+        collector->fields.push_back({std::string(event.key), true, std::string(event.text),
+                                     event.type == JSON_TRUE ? 1.0 : 0.0});
+    }
 }
 
-std::string Puara::prepare_index() {
-    Puara::mount_spiffs();
-    std::cout << "http (spiffs): Reading index file" << std::endl;
-    std::ifstream in("/spiffs/index.html");
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
-    // Put the module info on the HTML before send response
-    Puara::find_and_replace("%DMINAME%", Puara::dmiName, contents);
-    if (Puara::StaIsConnected) {
-        Puara::find_and_replace("%STATUS%", "Currently connected on "
-                                             "<strong style=\"color:Tomato;\">" + 
-                                             Puara::wifiSSID + "</strong> network", 
-                                             contents);
-    } else {
-        Puara::find_and_replace("%STATUS%", "Currently not connected to any network", 
-                                 contents);
-    }
-    Puara::find_and_replace("%CURRENTSSID%", Puara::currentSSID, contents);
-    Puara::find_and_replace("%CURRENTPSK%", Puara::wifiPSK, contents);
-    Puara::checkmark("%CURRENTPERSISTENT%", Puara::persistentAP, contents);
-    Puara::find_and_replace("%DEVICENAME%", Puara::device, contents);
-    Puara::find_and_replace("%CURRENTOSC1%", Puara::oscIP1, contents);
-    Puara::find_and_replace("%CURRENTPORT1%", Puara::oscPORT1, contents);
-    Puara::find_and_replace("%CURRENTOSC2%", Puara::oscIP2, contents);
-    Puara::find_and_replace("%CURRENTPORT2%", Puara::oscPORT2, contents);
-    Puara::find_and_replace("%CURRENTLOCALPORT%", Puara::localPORT, contents);
-    Puara::find_and_replace("%CURRENTSSID2%", Puara::wifiSSID, contents);
-    Puara::find_and_replace("%CURRENTIP%", Puara::currentSTA_IP, contents);
-    Puara::find_and_replace("%CURRENTAPIP%", Puara::currentAP_IP, contents);
-    Puara::find_and_replace("%CURRENTSTAMAC%", Puara::currentSTA_MAC, contents);
-    Puara::find_and_replace("%CURRENTAPMAC%", Puara::currentAP_MAC, contents);
-    std::ostringstream tempBuf;
-    tempBuf << std::setfill('0') << std::setw(3) << std::hex << Puara::id;
-    Puara::find_and_replace("%MODULEID%", tempBuf.str(), contents);
-    Puara::find_and_replace("%MODULEAUTH%", Puara::author, contents);
-    Puara::find_and_replace("%MODULEINST%", Puara::institution, contents);
-    Puara::find_and_replace("%MODULEVER%", Puara::version, contents);
+void Puara::collect_settings_field(void* context, const jsonEvent& event) {
+    jsonCollector* collector = static_cast<jsonCollector*>(context);
+    // settings.json is {"settings": [{"name": ..., "value": ...}, ...]}
+    if (event.depth == 1 && event.key == "settings") {
+        if (event.type == JSON_BEGIN_ARRAY) {
+            collector->in_settings = true;
+        }
+    } else if (event.depth == 1 && event.type == JSON_END_ARRAY) {
+        collector->in_settings = false;
+    } else if (collector->in_settings && event.depth == 2) {
+        if (event.type == JSON_BEGIN_OBJECT) {
+            collector->current = {std::string(), false, std::string(), 0};
+            collector->current_too_long = false;
+        } else if (event.type == JSON_END_OBJECT && collector->current_too_long) {
+            collector->too_long.push_back(collector->current.name);
+        } else if (event.type == JSON_END_OBJECT && !collector->current.name.empty()) {
+            collector->fields.push_back(collector->current);
+        }
+    } else if (collector->in_settings && event.depth == 3) {
+        if (event.too_long) {
+            collector->current_too_long = true;
+        }
+        if (event.key == "name" && event.type == JSON_STRING) {
+            collector->current.name = event.text;
+        } else if (event.key == "value") {
+            collector->current.is_number = (event.type == JSON_NUMBER);
+            collector->current.text = event.text;
+            collector->current.number = event.number;
+        }
+    }
+}
 
-    Puara::unmount_spiffs();
+enum jsonStates {
+    JSON_EXPECT_VALUE,
+    JSON_EXPECT_VALUE_OR_END,
+    JSON_EXPECT_KEY,
+    JSON_EXPECT_KEY_OR_END,
+    JSON_EXPECT_COLON,
+    JSON_AFTER_VALUE,
+    JSON_IN_STRING,
+    JSON_IN_ESCAPE,
+    JSON_IN_UNICODE,
+    JSON_IN_NUMBER,
+    JSON_IN_LITERAL,
+    JSON_DONE
+};
 
-    return contents;
+void Puara::jsonStream::begin(void (*event_handler)(void* context, const jsonEvent& event), void* event_context) {
+    handler = event_handler;
+    context = event_context;
+    state = JSON_EXPECT_VALUE;
+    depth = 0;
+    error = false;
+    parsing_key = false;
+    high_surrogate = 0;
+    key_too_long = false;
+    token_too_long = false;
+    // a long value read before must not stay allocated with the stream
+    key.clear();
+    key.shrink_to_fit();
+    token.clear();
+    token.shrink_to_fit();
 }
 
-esp_err_t Puara::index_get_handler(httpd_req_t *req) {
-
-    std::string prepared_index = prepare_index();
-    httpd_resp_sendstr(req, prepared_index.c_str());
+bool Puara::jsonStream::append(char c) {
+    // Strings past the limit are cut and flagged, numbers and literals that
+    // long are malformed
+    std::string& text = parsing_key ? key : token;
+    if (text.length() >= PUARA_JSON_TOKEN_SIZE) {
+        if (state != JSON_IN_STRING) {
+            return false;
+        }
+        (parsing_key ? key_too_long : token_too_long) = true;
+        return true;
+    }
+    text.push_back(c);
+    return true;
+}
 
-    return ESP_OK;
+bool Puara::jsonStream::append_utf8(unsigned int code_point) {
+    if (code_point < 0x80) {
+        return append(code_point);
+    } else if (code_point < 0x800) {
+        return append(0xC0 | (code_point >> 6)) && append(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        return append(0xE0 | (code_point >> 12)) && append(0x80 | ((code_point >> 6) & 0x3F)) &&
+               append(0x80 | (code_point & 0x3F));
+    }
+    return append(0xF0 | (code_point >> 18)) && append(0x80 | ((code_point >> 12) & 0x3F)) &&
+           append(0x80 | ((code_point >> 6) & 0x3F)) && append(0x80 | (code_point & 0x3F));
 }
 
-esp_err_t Puara::settings_get_handler(httpd_req_t *req) {
+void Puara::jsonStream::emit(jsonEventType type, double number) {
+    jsonEvent event;
+    event.type = type;
+    event.depth = depth;
+    event.key = (depth > 0 && containers[depth - 1] == '{' && type != JSON_END_OBJECT && 
+                 type != JSON_END_ARRAY) ? std::string_view(key) : std::string_view();
+    event.text = token;
+    event.number = number;
+    event.too_long = (!event.key.empty() && key_too_long) || (type == JSON_STRING && token_too_long);
+    handler(context, event);
+}
 
-    Puara::mount_spiffs();
-    std::cout << "http (spiffs): Reading settings file" << std::endl;
-    std::ifstream in("/spiffs/settings.html");
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
+bool Puara::jsonStream::open(char container) {
+    if (depth == PUARA_JSON_MAX_DEPTH) {
+        return false;
+    }
+    token.clear();
+    emit(container == '{' ? JSON_BEGIN_OBJECT : JSON_BEGIN_ARRAY);
+    containers[depth++] = container;
+    state = (container == '{') ? JSON_EXPECT_KEY_OR_END : JSON_EXPECT_VALUE_OR_END;
+    return true;
+}
 
-    std::cout << "settings_get_handler: Adding variables to HTML" << std::endl;
-    std::string settings;
-    for (auto it : variables) {
-        if (it.type == "text") {
-            settings.append("<div class=\"row\"><div class=\"col-25\"><label for=\"%PARAMETER%\">%PARAMETER%</label></div><div class=\"col-75\"><input type=\"text\" id=\"%PARAMETER%\" name=\"%PARAMETER%\" value=\"%PARAMETERVALUE%\"></div></div>");
-            find_and_replace("%PARAMETERVALUE%", it.textValue, settings);
-            find_and_replace("%PARAMETER%", it.name, settings);
-        } else if (it.type == "number") {
-            settings.append("<div class=\"row\"><div class=\"col-25\"><label for=\"%PARAMETER%\">%PARAMETER%</label></div><div class=\"col-75\"><input type=\"number\" step=\"0.000001\" id=\"%PARAMETER%\" name=\"%PARAMETER%\" value=\"%PARAMETERVALUE%\"></div></div>");
-            find_and_replace("%PARAMETERVALUE%", it.numberValue, settings);
-            find_and_replace("%PARAMETER%", it.name, settings);
-        }
-    }
-    find_and_replace("%DATAFROMMODULE%", settings, contents);
-    httpd_resp_sendstr(req, contents.c_str());
-    
-    return ESP_OK;
+bool Puara::jsonStream::close(char container) {
+    if (depth == 0 || containers[depth - 1] != container) {
+        return false;
+    }
+    depth--;
+    token.clear();
+    emit(container == '{' ? JSON_END_OBJECT : JSON_END_ARRAY);
+    value_done();
+    return true;
 }
 
-esp_err_t Puara::settings_post_handler(httpd_req_t *req) {
-    char buf[200];
-    
-    int api_return, remaining = req->content_len;
+void Puara::jsonStream::value_done() {
+    state = (depth == 0) ? JSON_DONE : JSON_AFTER_VALUE;
+}
 
-    while (remaining > 0) {
-        /* Read the data for the request */
-        if ((api_return = httpd_req_recv(req, buf,
-                        MIN(remaining, sizeof(buf)))) <= 0) {
-            if (api_return == HTTPD_SOCK_ERR_TIMEOUT) {
-                /* Retry receiving if timeout occurred */
-                continue;
-            }
-            return ESP_FAIL;
-        }
-        std::string str_buf = convertToString(buf);
-        std::string str_token;
-        std::string field;
-        size_t pos = 0;
-        size_t field_pos = 0;
-        std::string delimiter = "&";
-        std::string field_delimiter = "=";
-        // adding delimiter to process last variable in the loop
-        str_buf.append(delimiter);
-
-        std::cout << "Settings stored:" << std::endl;
-        while ((pos = str_buf.find(delimiter)) != std::string::npos) {
-            str_token = str_buf.substr(0, pos);
-            field_pos = str_buf.find(field_delimiter);
-            field = str_token.substr(0, field_pos);
-            str_token.erase(0, field_pos + field_delimiter.length());
-            std::cout << field << ": ";
-            if (variables.at(variables_fields.at(field)).type == "text") {
-                variables.at(variables_fields.at(field)).textValue = urlDecode(str_token);
-            } else if (variables.at(variables_fields.at(field)).type == "number") {
-                variables.at(variables_fields.at(field)).numberValue = std::stod(str_token);
-            }
-            std::cout << str_token << std::endl;
-            str_buf.erase(0, pos + delimiter.length());
+bool Puara::jsonStream::feed(const char* data, size_t length) {
+    for (size_t i = 0; i < length && !error; i++) {
+        char c = data[i];
+        bool whitespace = (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+        switch (state) {
+            case JSON_EXPECT_VALUE:
+            case JSON_EXPECT_VALUE_OR_END:
+                if (whitespace) {
+                    break;
+                } else if (c == '{' || c == '[') {
+                    error = !open(c);
+                } else if (c == ']' && state == JSON_EXPECT_VALUE_OR_END) {
+                    error = !close('[');
+                } else if (c == '"') {
+                    parsing_key = false;
+                    token.clear();
+                    token_too_long = false;
+                    state = JSON_IN_STRING;
+                } else if (c == '-' || (c >= '0' && c <= '9')) {
+                    token.clear();
+                    append(c);
+                    state = JSON_IN_NUMBER;
+                } else if (c == 't' || c == 'f' || c == 'n') {
+                    token.clear();
+                    append(c);
+                    state = JSON_IN_LITERAL;
+                } else {
+                    error = true;
+                }
+                break;
+            case JSON_EXPECT_KEY:
+            case JSON_EXPECT_KEY_OR_END:
+                if (whitespace) {
+                    break;
+                } else if (c == '"') {
+                    parsing_key = true;
+                    key.clear();
+                    key_too_long = false;
+                    state = JSON_IN_STRING;
+                } else if (c == '}' && state == JSON_EXPECT_KEY_OR_END) {
+                    error = !close('{');
+                } else {
+                    error = true;
+                }
+                break;
+            case JSON_EXPECT_COLON:
+                if (c == ':') {
+                    state = JSON_EXPECT_VALUE;
+                } else if (!whitespace) {
+                    error = true;
+                }
+                break;
+            case JSON_AFTER_VALUE:
+                if (whitespace) {
+                    break;
+                } else if (c == ',') {
+                    state = (containers[depth - 1] == '{') ? JSON_EXPECT_KEY : JSON_EXPECT_VALUE;
+                } else if (c == '}' || c == ']') {
+                    error = !close(c == '}' ? '{' : '[');
+                } else {
+                    error = true;
+                }
+                break;
+            case JSON_IN_STRING:
+                if (c == '"') {
+                    if (parsing_key) {
+                        parsing_key = false;
+                        state = JSON_EXPECT_COLON;
+                    } else {
+                        emit(JSON_STRING);
+                        value_done();
+                    }
+                } else if (c == '\\') {
+                    state = JSON_IN_ESCAPE;
+                } else if ((unsigned char) c < 0x20) {
+                    error = true;
+                } else {
+                    error = !append(c);
+                }
+                break;
+            case JSON_IN_ESCAPE:
+                state = JSON_IN_STRING;
+                switch (c) {
+                    case '"': case '\\': case '/': error = !append(c); break;
+                    case 'b': error = !append('\b'); break;
+                    case 'f': error = !append('\f'); break;
+                    case 'n': error = !append('\n'); break;
+                    case 'r': error = !append('\r'); break;
+                    case 't': error = !append('\t'); break;
+                    case 'u':
+                        unicode = 0;
+                        unicode_digits = 0;
+                        state = JSON_IN_UNICODE;
+                        break;
+                    default: error = true; break;
+                }
+                break;
+            case JSON_IN_UNICODE:
+                if (c >= '0' && c <= '9') {
+                    unicode = (unicode << 4) | (c - '0');
+                } else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+                    unicode = (unicode << 4) | ((c | 0x20) - 'a' + 10);
+                } else {
+                    error = true;
+                    break;
+                }
+                if (++unicode_digits == 4) {
+                    state = JSON_IN_STRING;
+                    if (unicode >= 0xD800 && unicode <= 0xDBFF) {
+                        high_surrogate = unicode;
+                    } else if (unicode >= 0xDC00 && unicode <= 0xDFFF && high_surrogate) {
+                        error = !append_utf8(0x10000 + ((high_surrogate - 0xD800) << 10) + (unicode - 0xDC00));
+                        high_surrogate = 0;
+                    } else {
+                        error = !append_utf8(unicode);
+                        high_surrogate = 0;
+                    }
+                }
+                break;
+            case JSON_IN_NUMBER:
+                if ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+                    error = !append(c);
+                } else {
+                    char* end;
+                    double number = strtod(token.c_str(), &end);
+                    if (end != token.c_str() + token.length()) {
+                        error = true;
+                        break;
+                    }
+                    emit(JSON_NUMBER, number);
+                    value_done();
+                    i--; // the character after the number still needs parsing
+                }
+                break;
+            case JSON_IN_LITERAL:
+                if (c >= 'a' && c <= 'z') {
+                    error = !append(c);
+                } else {
+                    if (token == "true") {
+                        emit(JSON_TRUE);
+                    } else if (token == "false") {
+                        emit(JSON_FALSE);
+                    } else if (token == "null") {
+                        emit(JSON_NULL);
+                    } else {
+                        error = true;
+                        break;
+                    }
+                    value_done();
+                    i--;
+                }
+                break;
+            case JSON_DONE:
+                if (!whitespace) {
+                    error = true;
+                }
+                break;
         }
-        std::cout << std::endl;
-        remaining -= api_return;
     }
-
-    write_settings_json();
-    mount_spiffs();
-    std::cout << "http (spiffs): Reading saved.html file" << std::endl;
-    std::ifstream in("/spiffs/saved.html");
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
-    httpd_resp_sendstr(req, contents.c_str());
-    unmount_spiffs();
-
-    return ESP_OK;
+    return !error;
 }
 
-esp_err_t Puara::get_handler(httpd_req_t *req) {
-
-    const char* resp_str = (const char*) req->user_ctx;
-    Puara::mount_spiffs();
-    std::cout << "http (spiffs): Reading requested file" << std::endl;
-    std::ifstream in(resp_str);
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
-    httpd_resp_sendstr(req, contents.c_str());
-    
-    Puara::unmount_spiffs();
+bool Puara::jsonStream::finish() {
+    if (state == JSON_IN_NUMBER || state == JSON_IN_LITERAL) {
+        // a bare top-level number or literal ends with the input
+        feed(" ", 1);
+    }
+    return !error && state == JSON_DONE;
+}
 
-    return ESP_OK;
+uint32_t Puara::crc32(uint32_t crc, const void* data, size_t length) {
+    // CRC-32 (IEEE 802.3, same as zlib), half-byte table
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc = table[(crc ^ bytes[i]) & 0x0F] ^ (crc >> 4);
+        crc = table[(crc ^ (bytes[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
 }
 
-esp_err_t Puara::style_get_handler(httpd_req_t *req) {
+bool Puara::begin_record(recordWriter& record, const char* path, uint32_t magic) {
+    record.header = {magic, PUARA_RECORD_VERSION, 0, 0, 0};
+    record.file = NULL;
+    record.error = false;
+    if (path == NULL) {
+        // dry run, only the length and CRC are computed
+        return true;
+    }
+    record.file = fopen(path, "wb");
+    record.error = (record.file == NULL);
+    if (record.error) {
+        std::cout << "SPIFFS: Failed to open " << path << std::endl;
+        return false;
+    }
+    // the header is rewritten with the final length and CRC once all fields are in
+    if (fwrite(&record.header, sizeof(record.header), 1, record.file) != 1) {
+        record.error = true;
+    }
+    return !record.error;
+}
 
-    const char* resp_str = (const char*) req->user_ctx;
-    Puara::mount_spiffs();
-    std::cout << "http (spiffs): Reading style.css file" << std::endl;
-    std::ifstream in(resp_str);
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
-    httpd_resp_set_type(req, "text/css");
-    httpd_resp_sendstr(req, contents.c_str());
-    
-    Puara::unmount_spiffs();
+void Puara::write_record_bytes(recordWriter& record, const void* data, size_t length) {
+    if (record.error) {
+        return;
+    }
+    if (record.file != NULL && fwrite(data, 1, length, record.file) != length) {
+        record.error = true;
+        return;
+    }
+    record.header.crc = crc32(record.header.crc, data, length);
+    record.header.length += length;
+}
 
-    return ESP_OK;
+void Puara::write_record_field(recordWriter& record, std::string_view name, std::string_view text) {
+    if (name.length() > UINT8_MAX || text.length() > UINT16_MAX) {
+        std::cout << "record: Field " << name << " too long, not saved" << std::endl;
+        return;
+    }
+    uint8_t tag[4] = {RECORD_TEXT, static_cast<uint8_t>(name.length()), 
+                      static_cast<uint8_t>(text.length() & 0xFF), static_cast<uint8_t>(text.length() >> 8)};
+    write_record_bytes(record, tag, sizeof(tag));
+    write_record_bytes(record, name.data(), name.length());
+    write_record_bytes(record, text.data(), text.length());
+    record.header.count++;
 }
 
-esp_err_t Puara::scan_get_handler(httpd_req_t *req) {
+void Puara::write_record_field(recordWriter& record, std::string_view name, double number) {
+    if (name.length() > UINT8_MAX) {
+        std::cout << "record: Field " << name << " too long, not saved" << std::endl;
+        return;
+    }
+    uint8_t tag[4] = {RECORD_NUMBER, static_cast<uint8_t>(name.length()), sizeof(number), 0};
+    write_record_bytes(record, tag, sizeof(tag));
+    write_record_bytes(record, name.data(), name.length());
+    write_record_bytes(record, &number, sizeof(number));
+    record.header.count++;
+}
 
-    const char* resp_str = (const char*) req->user_ctx;
-    Puara::mount_spiffs();
-    std::cout << "http (spiffs): Reading scan.html file" << std::endl;
-    std::ifstream in(resp_str);
-    std::string contents((std::istreambuf_iterator<char>(in)), 
-    std::istreambuf_iterator<char>());
-    wifi_scan();
-    find_and_replace("%SSIDS%", wifiAvailableSsid, contents);
-    httpd_resp_sendstr(req, contents.c_str());
-    
-    Puara::unmount_spiffs();
+bool Puara::finish_record(recordWriter& record, const char* temp_path, const char* path) {
+    if (!record.error) {
+        if (fseek(record.file, 0, SEEK_SET) != 0 || 
+            fwrite(&record.header, sizeof(record.header), 1, record.file) != 1 ||
+            fflush(record.file) != 0 || fsync(fileno(record.file)) != 0) {
+            record.error = true;
+        }
+    }
+    if (record.file != NULL) {
+        fclose(record.file);
+    }
+    if (record.error) {
+        std::cout << "SPIFFS: Failed to write " << temp_path << std::endl;
+        remove(temp_path);
+        return false;
+    }
+    return Puara::replace_file(temp_path, path);
+}
 
-    return ESP_OK;
+bool Puara::replace_file(const char* temp_path, const char* path) {
+    // SPIFFS cannot rename over an existing file. Until the rename is done,
+    // readers pick up the complete temporary copy.
+    remove(path);
+    if (rename(temp_path, path) != 0) {
+        std::cout << "SPIFFS: Failed to rename " << temp_path << std::endl;
+        return false;
+    }
+    return true;
 }
 
-// esp_err_t Puara::update_get_handler(httpd_req_t *req) {
+bool Puara::read_record(const char* path, uint32_t magic, std::vector<jsonField>& fields) {
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    std::string contents(size > 0 ? size : 0, '\0');
+    size_t read_length = fread(&contents[0], 1, contents.size(), f);
+    fclose(f);
 
-//     const char* resp_str = (const char*) req->user_ctx;
-//     Puara::mount_spiffs();
-//     std::cout << "http (spiffs): Reading update.html file" << std::endl;
-//     std::ifstream in(resp_str);
-//     std::string contents((std::istreambuf_iterator<char>(in)), 
-//     std::istreambuf_iterator<char>());
-//     //httpd_resp_set_type(req, "text/html");
-//     httpd_resp_sendstr(req, contents.c_str());
-    
-//     Puara::unmount_spiffs();
+    recordHeader header;
+    if (read_length != contents.size() || contents.size() < sizeof(header)) {
+        std::cout << "record: " << path << " is truncated" << std::endl;
+        return false;
+    }
+    memcpy(&header, contents.data(), sizeof(header));
+    const char* data = contents.data() + sizeof(header);
+    if (header.magic != magic || header.version != PUARA_RECORD_VERSION || 
+        header.length != contents.size() - sizeof(header) || 
+        crc32(0, data, header.length) != header.crc) {
+        std::cout << "record: " << path << " is not a valid record" << std::endl;
+        return false;
+    }
 
-//     return ESP_OK;
-// }
+    const char* end = data + header.length;
+    std::vector<jsonField> record_fields;
+    record_fields.reserve(header.count);
+    for (unsigned int i = 0; i < header.count; i++) {
+        if (end - data < 4) {
+            return false;
+        }
+        uint8_t type = data[0];
+        size_t name_length = static_cast<uint8_t>(data[1]);
+        size_t value_length = static_cast<uint8_t>(data[2]) | (static_cast<uint8_t>(data[3]) << 8);
+        data += 4;
+        if (static_cast<size_t>(end - data) < name_length + value_length) {
+            return false;
+        }
+        jsonField field;
+        field.name.assign(data, name_length);
+        data += name_length;
+        if (type == RECORD_NUMBER && value_length == sizeof(field.number)) {
+            field.is_number = true;
+            memcpy(&field.number, data, sizeof(field.number));
+        } else if (type == RECORD_TEXT) {
+            field.is_number = false;
+            field.text.assign(data, value_length);
+            field.number = 0;
+        } else {
+            std::cout << "record: Unknown field type in " << path << std::endl;
+            return false;
+        }
+        data += value_length;
+        record_fields.push_back(std::move(field));
+    }
+    fields.swap(record_fields);
+    return data == end;
+}
 
-esp_err_t Puara::index_post_handler(httpd_req_t *req) {
-    char buf[200];
-    bool ret_flag = false;
-    
-    int api_return, remaining = req->content_len;
+void Puara::init_nvs() {
+    if (nvs_initialized) {
+        return;
+    }
+    //Initialize NVS
+    esp_err_t ret = nvs_flash_init();
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        ret = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(ret);
+    nvs_initialized = true;
+}
 
-    while (remaining > 0) {
-        /* Read the data for the request */
-        if ((api_return = httpd_req_recv(req, buf,
-                        MIN(remaining, sizeof(buf)))) <= 0) {
-            if (api_return == HTTPD_SOCK_ERR_TIMEOUT) {
-                /* Retry receiving if timeout occurred */
-                continue;
+void Puara::read_config() {
+    int64_t start_time = esp_timer_get_time();
+    std::vector<jsonField> fields;
+#ifdef PUARA_CONFIG_NVS
+    if (Puara::read_config_nvs()) {
+        std::cout << "config: Loaded from NVS in " << (esp_timer_get_time() - start_time) << " us" << std::endl;
+        return;
+    }
+    std::cout << "config: Not in NVS yet, migrating" << std::endl;
+#endif
+    std::cout << "config: Reading config record" << std::endl;
+    // a complete .new is newer than .bin: it was synced but not renamed yet
+    if (Puara::read_record("/spiffs/config.new", config_magic, fields) || 
+        Puara::read_record("/spiffs/config.bin", config_magic, fields)) {
+        Puara::apply_config_fields(fields);
+#ifdef PUARA_CONFIG_NVS
+        Puara::write_config();
+#else
+        std::lock_guard<std::mutex> lock(persistence_mutex);
+        recordWriter record;
+        Puara::begin_record(record, NULL, config_magic);
+        Puara::write_config_fields(record);
+        config_record_crc = record.header.crc;
+        config_record_valid = true;
+#endif
+    } else {
+        std::cout << "config: No valid record, importing config.json" << std::endl;
+        Puara::read_config_json();
+        Puara::write_config();
+    }
+    std::cout << "config: Loaded from SPIFFS in " << (esp_timer_get_time() - start_time) << " us" << std::endl;
+}
+
+#ifdef PUARA_CONFIG_NVS
+bool Puara::read_config_nvs() {
+    Puara::init_nvs();
+    nvs_handle_t handle;
+    if (nvs_open(PUARA_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return false;
+    }
+    // The schema key marks a store written by write_config_nvs(). Stores from
+    // before it was added always hold "device", so they count as schema 1.
+    uint32_t schema = 0;
+    size_t device_length = 0;
+    if (nvs_get_u32(handle, "schema", &schema) != ESP_OK &&
+        nvs_get_str(handle, "device", NULL, &device_length) != ESP_OK) {
+        nvs_close(handle);
+        return false;
+    }
+    std::vector<jsonField> fields;
+    fields.reserve(config_keys_count);
+    bool complete = (schema == nvs_schema);
+    for (size_t i = 0; i < config_keys_count; i++) {
+        jsonField field;
+        field.name = std::string(config_keys[i].name);
+        field.is_number = config_keys[i].is_number;
+        field.number = 0;
+        bool found;
+        if (field.is_number) {
+            uint32_t value;
+            found = (nvs_get_u32(handle, field.name.c_str(), &value) == ESP_OK);
+            field.number = value;
+        } else {
+            size_t length = 0;
+            found = (nvs_get_str(handle, field.name.c_str(), NULL, &length) == ESP_OK && length > 0);
+            if (found) {
+                field.text.resize(length);
+                found = (nvs_get_str(handle, field.name.c_str(), &field.text[0], &length) == ESP_OK);
+                // drop the terminator NVS stores with the string
+                field.text.resize(length - 1);
             }
-            return ESP_FAIL;
         }
+        if (!found) {
+            // keys added after the store was written keep their default
+            std::cout << "config: " << field.name << " not in NVS, using the default" << std::endl;
+            complete = false;
+            continue;
+        }
+        fields.push_back(std::move(field));
+    }
+    nvs_close(handle);
+    Puara::apply_config_fields(fields);
+    if (!complete) {
+        // bring the store up to the current schema
+        Puara::write_config_nvs();
+    }
 
-        std::string str_buf = convertToString(buf);
-        std::string str_token;
-        std::string field;
-        size_t pos = 0;
-        size_t field_pos = 0;
-        std::string delimiter = "&";
-        std::string field_delimiter = "=";
-        // adding delimiter to process last variable in the loop
-        str_buf.append(delimiter);
-        bool checkbox_persistentAP = false;
-
-        while ((pos = str_buf.find(delimiter)) != std::string::npos) {
-            str_token = str_buf.substr(0, pos);
-            field_pos = str_buf.find(field_delimiter);
-            field = str_token.substr(0, field_pos);
-            str_token.erase(0, field_pos + field_delimiter.length());
-            if (config_fields.find(field) != config_fields.end()) {
-                switch (config_fields.at(field)) {
-                    case 1:
-                        std::cout << "SSID: " << str_token << std::endl;
-                        if ( !str_token.empty() ) { 
-                            wifiSSID = urlDecode(str_token);
-                        } else {
-                            std::cout << "SSID empty! Keeping the stored value" << std::endl;
-                        }
-                        break;
-                    case 2:
-                        std::cout << "APpasswd: " << str_token << std::endl;
-                        if ( !str_token.empty() ) { 
-                            APpasswdVal1 = urlDecode(str_token); 
-                        } else {
-                            std::cout << "APpasswd empty! Keeping the stored value" << std::endl;
-                            APpasswdVal1.clear();
-                        };
-                        break;
-                    case 3:
-                        std::cout << "APpasswdValidate: " << str_token << std::endl;
-                        if ( !str_token.empty() ) { 
-                            APpasswdVal2 = urlDecode(str_token);
-                        } else {
-                            std::cout << "APpasswdValidate empty! Keeping the stored value" << std::endl;
-                            APpasswdVal2.clear();
-                        };
-                        break;
-                    case 4:
-                        std::cout << "oscIP1: " << str_token << std::endl;
-                        if ( !str_token.empty() ) {
-                            oscIP1 = str_token;
-                        } else {
-                            std::cout << "oscIP1 empty! Keeping the stored value" << std::endl;
-                        }
-                        break;
-                    case 5:
-                        std::cout << "oscPORT1: " << str_token << std::endl;
-                        if ( !str_token.empty() ) {
-                            oscPORT1 = stoi(str_token);
-                        } else {
-                            std::cout << "oscPORT1 empty! Keeping the stored value" << std::endl;
-                        }
-                        break;
-                    case 6:
-                        std::cout << "oscIP2: " << str_token << std::endl;
-                        if ( !str_token.empty() ) {
-                            oscIP2 = str_token;
-                        } else {
-                            std::cout << "oscIP2 empty! Keeping the stored value" << std::endl;
-                        }
-                        break;
-                    case 7:
-                        std::cout << "oscPORT2: " << str_token << std::endl;
-                        if ( !str_token.empty() ) {
-                            oscPORT2 = stoi(str_token);
-                        } else {
-                            std::cout << "oscPORT2 empty! Keeping the stored value" << std::endl;
-                        }
-                        break;
-                    case 8:
-                        std::cout << "password: " << str_token << std::endl;
-                        if ( !str_token.empty() ) { 
-                            wifiPSK = urlDecode(str_token);
-                        } else {
-                            std::cout << "password empty! Keeping the stored value" << std::endl;
-                        }
-                        break;
-                    case 9:
-                        std::cout << "Rebooting\n";
-                        ret_flag = true;
-                        break;
-                    case 10:
-                        std::cout << "persistentAP: " << str_token << std::endl;
-                        checkbox_persistentAP = true;
-                        break;
-                    case 11:
-                        std::cout << "localPORT: " << str_token << std::endl;
-                        if ( !str_token.empty() ) {
-                            localPORT = stoi(str_token);
-                        } else {
-                            std::cout << "localPORT empty! Keeping the stored value" << std::endl;
-                        }
-                        break;
-                    default:
-                        std::cout << "Error, no match for config field to store received data\n";
-                        break; 
-                }
-            } else {
-                std::cout << "Error, no match for config field to store received data: " << field << std::endl;
-            }
-            str_buf.erase(0, pos + delimiter.length());
+    std::lock_guard<std::mutex> lock(persistence_mutex);
+    recordWriter record;
+    Puara::begin_record(record, NULL, config_magic);
+    Puara::write_config_fields(record);
+    config_record_crc = record.header.crc;
+    config_record_valid = true;
+    return true;
+}
+
+bool Puara::write_config_nvs() {
+    Puara::init_nvs();
+    nvs_handle_t handle;
+    if (nvs_open(PUARA_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK) {
+        std::cout << "config: Failed to open NVS" << std::endl;
+        return false;
+    }
+    esp_err_t err = ESP_OK;
+    auto set_text = [&](const char* key, const std::string& value) {
+        if (err == ESP_OK) {
+            err = nvs_set_str(handle, key, value.c_str());
+        }
+    };
+    auto set_number = [&](const char* key, uint32_t value) {
+        if (err == ESP_OK) {
+            err = nvs_set_u32(handle, key, value);
+        }
+    };
+    for (const auto& field : config_snapshot()) {
+        if (field.is_number) {
+            set_number(field.name.c_str(), field.number);
+        } else {
+            set_text(field.name.c_str(), field.text);
         }
+    }
+    set_number("schema", nvs_schema);
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        std::cout << "config: Failed to save to NVS (" << esp_err_to_name(err) << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
+#endif
+
+std::vector<Puara::jsonField> Puara::config_snapshot() {
+    // Copied under config_mutex so the persistence task never reads the
+    // strings while the web server or serial commands change them
+    std::lock_guard<std::mutex> lock(config_mutex);
+    std::vector<jsonField> fields;
+    fields.reserve(config_keys_count);
+    auto text = [&](const char* name, const std::string& value) {
+        fields.push_back({name, false, value, 0});
+    };
+    auto number = [&](const char* name, double value) {
+        fields.push_back({name, true, std::string(), value});
+    };
+    text("device", device);
+    number("id", id);
+    text("author", author);
+    text("institution", institution);
+    text("APpasswd", APpasswd);
+    text("wifiSSID", wifiSSID);
+    text("wifiPSK", wifiPSK);
+    number("persistentAP", persistentAP ? 1 : 0);
+    text("oscIP1", oscIP1);
+    number("oscPORT1", oscPORT1);
+    text("oscIP2", oscIP2);
+    number("oscPORT2", oscPORT2);
+    number("localPORT", localPORT);
+    text("oscDestinations", oscDestinations);
+    return fields;
+}
 
-        // processing some post info
-        if ( APpasswdVal1 == APpasswdVal2 && !APpasswdVal1.empty() && APpasswdVal1.length() > 7 ) {
-            APpasswd = APpasswdVal1;
-            std::cout << "Puara password changed!\n";
+void Puara::write_config_fields(recordWriter& record) {
+    for (const auto& field : config_snapshot()) {
+        if (field.is_number) {
+            write_record_field(record, field.name, field.number);
         } else {
-            std::cout << "Puara password doesn't match or shorter than 8 characteres. Passwork not changed.\n";
+            write_record_field(record, field.name, field.text);
         }
-        persistentAP = checkbox_persistentAP;
-        APpasswdVal1.clear(); APpasswdVal2.clear();
+    }
+}
 
-        remaining -= api_return;
+void Puara::write_config() {
+    std::lock_guard<std::mutex> lock(persistence_mutex);
+    recordWriter record;
+    Puara::begin_record(record, NULL, config_magic);
+    Puara::write_config_fields(record);
+    if (config_record_valid && record.header.crc == config_record_crc) {
+        std::cout << "config: Unchanged, not saved" << std::endl;
+        return;
     }
+#ifdef PUARA_CONFIG_NVS
+    if (Puara::write_config_nvs()) {
+        config_record_crc = record.header.crc;
+        config_record_valid = true;
+        std::cout << "config: Saved to NVS" << std::endl;
+    }
+#else
+    Puara::mount_spiffs();
+    if (!Puara::begin_record(record, "/spiffs/config.new", config_magic)) {
+        return;
+    }
+    Puara::write_config_fields(record);
+    if (Puara::finish_record(record, "/spiffs/config.new", "/spiffs/config.bin")) {
+        config_record_crc = record.header.crc;
+        config_record_valid = true;
+        std::cout << "config: Saved " << record.header.count << " fields" << std::endl;
+    }
+#endif
+}
 
-    if (ret_flag) {
-        mount_spiffs();
-        std::cout << "http (spiffs): Reading reboot.html file" << std::endl;
-        std::ifstream in("/spiffs/reboot.html");
-        std::string contents((std::istreambuf_iterator<char>(in)), 
-        std::istreambuf_iterator<char>());
-        httpd_resp_sendstr(req, contents.c_str());
-        unmount_spiffs();
-        std::cout <<  "\nRebooting...\n" << std::endl;
-        xTaskCreate(&Puara::reboot_with_delay, "reboot_with_delay", 1024, NULL, 10, NULL);
-    } else {
-        write_config_json();
-        mount_spiffs();
-        std::cout << "http (spiffs): Reading saved.html file" << std::endl;
-        std::ifstream in("/spiffs/saved.html");
-        std::string contents((std::istreambuf_iterator<char>(in)), 
-        std::istreambuf_iterator<char>());
-        httpd_resp_sendstr(req, contents.c_str());
-        unmount_spiffs();
+void Puara::read_settings() {
+    std::vector<jsonField> fields;
+    std::cout << "settings: Reading settings record" << std::endl;
+    // a complete .new is newer than .bin: it was synced but not renamed yet
+    if (Puara::read_record("/spiffs/settings.new", settings_magic, fields) || 
+        Puara::read_record("/spiffs/settings.bin", settings_magic, fields)) {
+        Puara::apply_settings_fields(fields, false);
+        std::lock_guard<std::mutex> lock(persistence_mutex);
+        recordWriter record;
+        Puara::begin_record(record, NULL, settings_magic);
+        Puara::write_settings_fields(record);
+        settings_record_crc = record.header.crc;
+        settings_record_valid = true;
+        return;
     }
+    std::cout << "settings: No valid record, importing settings.json" << std::endl;
+    Puara::read_settings_json();
+    Puara::write_settings();
+}
 
-    return ESP_OK;
+void Puara::write_settings_fields(recordWriter& record) {
+    settingsReadGuard guard;
+    const settingsStore& variables = guard->variables;
+    for (size_t i = 0; i < variables.size(); i++) {
+        if (variables.types[i] == SETTING_TEXT) {
+            write_record_field(record, variables.name(i), variables.text(i));
+        } else {
+            write_record_field(record, variables.name(i), variables.numbers[i]);
+        }
+    }
+}
+
+void Puara::write_settings() {
+    std::lock_guard<std::mutex> lock(persistence_mutex);
+    recordWriter record;
+    Puara::begin_record(record, NULL, settings_magic);
+    Puara::write_settings_fields(record);
+    if (settings_record_valid && record.header.crc == settings_record_crc) {
+        std::cout << "settings: Unchanged, not saved" << std::endl;
+        return;
+    }
+    Puara::mount_spiffs();
+    if (!Puara::begin_record(record, "/spiffs/settings.new", settings_magic)) {
+        return;
+    }
+    Puara::write_settings_fields(record);
+    if (Puara::finish_record(record, "/spiffs/settings.new", "/spiffs/settings.bin")) {
+        settings_record_crc = record.header.crc;
+        settings_record_valid = true;
+        std::cout << "settings: Saved " << record.header.count << " fields" << std::endl;
+    }
 }
 
-void Puara::find_and_replace(std::string old_text, std::string new_text, std::string & str) {
+void Puara::save_config() {
+    config_dirty = true;
+    if (persistence_task == NULL) {
+        Puara::flush_changes();
+    } else {
+        xTaskNotifyGive(persistence_task);
+    }
+}
 
-    std::size_t old_text_position = str.find(old_text);
-    while (old_text_position!=std::string::npos) {
-        str.replace(old_text_position,old_text.length(),new_text);
-        old_text_position = str.find(old_text);
+void Puara::save_settings() {
+    settings_dirty = true;
+    if (persistence_task == NULL) {
+        Puara::flush_changes();
+    } else {
+        xTaskNotifyGive(persistence_task);
     }
-    std::cout << "http (find_and_replace): Success" << std::endl;
 }
 
-void Puara::find_and_replace(std::string old_text, double new_number, std::string & str) {
+void Puara::flush_changes() {
+    if (config_dirty.exchange(false)) {
+        Puara::write_config();
+    }
+    if (settings_dirty.exchange(false)) {
+        Puara::write_settings();
+    }
+}
 
-    std::size_t old_text_position = str.find(old_text);
-    while (old_text_position!=std::string::npos) {
-        std::string conversion = std::to_string(new_number);
-        str.replace(old_text_position,old_text.length(),conversion);
-        old_text_position = str.find(old_text);
+void Puara::persist_changes(void *arg) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // keep waiting while changes arrive, a burst of form posts or
+        // serial commands ends up in a single write
+        TickType_t first_change = xTaskGetTickCount();
+        while (!flush_requested.load() &&
+               ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(PUARA_SAVE_DELAY_MS)) != 0 &&
+               xTaskGetTickCount() - first_change < pdMS_TO_TICKS(PUARA_SAVE_MAX_DELAY_MS)) {
+        }
+        Puara::flush_changes();
+        if (flush_requested.exchange(false)) {
+            // also write what changed while the previous write was running
+            Puara::flush_changes();
+            xTaskNotifyGive(flush_waiter);
+        }
     }
-    std::cout << "http (find_and_replace): Success" << std::endl;
 }
 
-void Puara::find_and_replace(std::string old_text, unsigned int new_number, std::string & str) {
+void Puara::write_config_json() {
+    std::string contents;
+    responseStream stream = {NULL, 0, ESP_OK, &contents};
+    Puara::stream_config_json(stream, true);
+    Puara::write_json_file("/spiffs/config.json.new", "/spiffs/config.json", contents);
+}
+
+void Puara::write_settings_json() {
+    std::string contents;
+    responseStream stream = {NULL, 0, ESP_OK, &contents};
+    Puara::stream_settings_json(stream);
+    Puara::write_json_file("/spiffs/settings.json.new", "/spiffs/settings.json", contents);
+}
 
-    std::size_t old_text_position = str.find(old_text);
-    while (old_text_position!=std::string::npos) {
-        std::string conversion = std::to_string(new_number);
-        str.replace(old_text_position,old_text.length(),conversion);
-        old_text_position = str.find(old_text);
+bool Puara::write_json_file(const char* temp_path, const char* path, std::string_view contents) {
+    // Written next to the file and renamed over it, as the records are, so a
+    // reboot halfway leaves the previous export in place
+    Puara::mount_spiffs();
+    std::cout << "SPIFFS: Saving " << path << std::endl;
+    FILE* f = fopen(temp_path, "w");
+    if (f == NULL) {
+        std::cout << "SPIFFS: Failed to open " << temp_path << std::endl;
+        return false;
+    }
+    bool written = fwrite(contents.data(), 1, contents.length(), f) == contents.length() &&
+                   fflush(f) == 0 && fsync(fileno(f)) == 0;
+    fclose(f);
+    if (!written) {
+        std::cout << "SPIFFS: Failed to write " << temp_path << std::endl;
+        remove(temp_path);
+        return false;
     }
-    std::cout << "http (find_and_replace): Success" << std::endl;
+    bool replaced = Puara::replace_file(temp_path, path);
+    Puara::invalidate_asset(path);
+    return replaced;
+}
+
+std::string Puara::get_dmi_name() {
+    std::lock_guard<std::mutex> lock(config_mutex);
+    return dmiName;
 }
 
-void Puara::checkmark(std::string old_text, bool value, std::string & str) {
+void Puara::compile_templates() {
+    std::cout << "http (spiffs): Compiling page templates" << std::endl;
+    Puara::read_template("/spiffs/index.html", Puara::index_template);
+    Puara::read_template("/spiffs/settings.html", Puara::settings_template);
+    Puara::read_template("/spiffs/scan.html", Puara::scan_template);
+    Puara::compile_template("<div class=\"row\"><div class=\"col-25\"><label for=\"%PARAMETER%\">%PARAMETER%</label></div><div class=\"col-75\"><input type=\"text\" id=\"%PARAMETER%\" name=\"%PARAMETER%\" value=\"%PARAMETERVALUE%\"></div></div>",
+                            Puara::settings_text_row);
+    Puara::compile_template("<div class=\"row\"><div class=\"col-25\"><label for=\"%PARAMETER%\">%PARAMETER%</label></div><div class=\"col-75\"><input type=\"number\" step=\"0.000001\" id=\"%PARAMETER%\" name=\"%PARAMETER%\" value=\"%PARAMETERVALUE%\"></div></div>",
+                            Puara::settings_number_row);
+}
 
-    std::size_t old_text_position = str.find(old_text);
-    if (old_text_position!=std::string::npos) {
-        std::string conversion;
-        if (value) {
-            conversion = "checked";
-        } else {
-            conversion = "";
+bool Puara::read_template(std::string path, pageTemplate& page) {
+    const puaraAsset* embedded = Puara::find_embedded_asset(path);
+    if (embedded && !embedded->gzipped) {
+        page.storage.reset();
+        Puara::compile_template(std::string_view(reinterpret_cast<const char*>(embedded->data), 
+                                                 embedded->length), page);
+        return true;
+    }
+    page.storage = Puara::get_asset(path);
+    if (!page.storage) {
+        std::cout << "http (spiffs): Failed to open " << path << std::endl;
+        Puara::compile_template(std::string_view(), page);
+        return false;
+    }
+    Puara::compile_template(*page.storage, page);
+    return true;
+}
+
+void Puara::compile_template(std::string_view source, pageTemplate& page) {
+    page.source = source;
+    page.etag = content_etag(source);
+    page.segments.clear();
+    page.literal_length = 0;
+
+    std::size_t literal_start = 0;
+    std::size_t search_position = 0;
+    std::size_t open_position;
+    while ((open_position = source.find('%', search_position)) != std::string_view::npos) {
+        std::size_t close_position = source.find('%', open_position + 1);
+        if (close_position == std::string_view::npos) {
+            break;
         }
-        str.replace(old_text_position,old_text.length(),conversion);
-        std::cout << "http (checkmark): Success" << std::endl;
-    } else {
-        std::cout << "http (checkmark): Could not find the requested string" << std::endl;
+        auto field = template_fields.find(std::string(source.substr(open_position + 1, 
+                                                      close_position - open_position - 1)));
+        if (field == template_fields.end()) {
+            // not a known token: the closing '%' may open the next one
+            search_position = close_position;
+            continue;
+        }
+        if (open_position > literal_start) {
+            page.segments.push_back({literal_start, open_position - literal_start, -1});
+            page.literal_length += open_position - literal_start;
+        }
+        page.segments.push_back({open_position, close_position - open_position + 1, field->second});
+        literal_start = search_position = close_position + 1;
+    }
+    if (literal_start < source.length()) {
+        page.segments.push_back({literal_start, source.length() - literal_start, -1});
+        page.literal_length += source.length() - literal_start;
     }
 }
 
-httpd_handle_t Puara::start_webserver(void) {
-    
-    if (!ApStarted) {
-        std::cout << "start_webserver: Cannot start webserver: AP and STA not initializated" << std::endl;
-        return NULL;
+void Puara::stream_write(responseStream& stream, const char* data, size_t length) {
+    if (stream.text != nullptr) {
+        stream.text->append(data, length);
+        return;
     }
-    Puara::webserver = NULL;
+    while (length > 0 && stream.error == ESP_OK) {
+        size_t copy_length = MIN(length, sizeof(response_buffer) - stream.length);
+        memcpy(response_buffer + stream.length, data, copy_length);
+        stream.length += copy_length;
+        data += copy_length;
+        length -= copy_length;
+        if (stream.length == sizeof(response_buffer)) {
+            stream.error = httpd_resp_send_chunk(stream.req, response_buffer, stream.length);
+            stream.length = 0;
+        }
+    }
+}
 
-    Puara::webserver_config.task_priority      = tskIDLE_PRIORITY+5;
-    Puara::webserver_config.stack_size         = 4096;
-    Puara::webserver_config.core_id            = tskNO_AFFINITY;
-    Puara::webserver_config.server_port        = 80;
-    Puara::webserver_config.ctrl_port          = 32768;
-    Puara::webserver_config.max_open_sockets   = 7;
-    Puara::webserver_config.max_uri_handlers   = 9;
-    Puara::webserver_config.max_resp_headers   = 9;
-    Puara::webserver_config.backlog_conn       = 5;
-    Puara::webserver_config.lru_purge_enable   = true;
-    Puara::webserver_config.recv_wait_timeout  = 5;
-    Puara::webserver_config.send_wait_timeout  = 5;
-    Puara::webserver_config.global_user_ctx = NULL;
-    Puara::webserver_config.global_user_ctx_free_fn = NULL;
-    Puara::webserver_config.global_transport_ctx = NULL;
-    Puara::webserver_config.global_transport_ctx_free_fn = NULL;
-    Puara::webserver_config.open_fn = NULL;
-    Puara::webserver_config.close_fn = NULL;
-    Puara::webserver_config.uri_match_fn = NULL;
+void Puara::stream_write(responseStream& stream, std::string_view text) {
+    stream_write(stream, text.data(), text.length());
+}
 
-    Puara::index.uri = "/";
-    Puara::index.method    = HTTP_GET,
-    Puara::index.handler   = index_get_handler,
-    Puara::index.user_ctx  = (char*)"/spiffs/index.html";
+void Puara::stream_printf(responseStream& stream, const char* format, ...) {
+    char conversion[32];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(conversion, sizeof(conversion), format, args);
+    va_end(args);
+    if (length <= 0) {
+        return;
+    }
+    if ((size_t)length < sizeof(conversion)) {
+        stream_write(stream, conversion, length);
+        return;
+    }
+    // Longer conversions (e.g. large doubles) are formatted again on the heap
+    std::string converted(length, '\0');
+    va_start(args, format);
+    vsnprintf(&converted[0], length + 1, format, args);
+    va_end(args);
+    stream_write(stream, converted);
+}
 
-    Puara::indexpost.uri = "/";
-    Puara::indexpost.method    = HTTP_POST,
-    Puara::indexpost.handler   = index_post_handler,
-    Puara::indexpost.user_ctx  = (char*)"/spiffs/index.html";
+esp_err_t Puara::stream_finish(responseStream& stream) {
+    if (stream.text != nullptr) {
+        return ESP_OK;
+    }
+    if (stream.error == ESP_OK && stream.length > 0) {
+        stream.error = httpd_resp_send_chunk(stream.req, response_buffer, stream.length);
+    }
+    if (stream.error == ESP_OK) {
+        // an empty chunk terminates the response
+        stream.error = httpd_resp_send_chunk(stream.req, NULL, 0);
+    }
+    if (stream.error != ESP_OK) {
+        std::cout << "http: Failed to send response (" << esp_err_to_name(stream.error) << ")" << std::endl;
+    }
+    return stream.error;
+}
 
-    Puara::style.uri = "/style.css";
-    Puara::style.method    = HTTP_GET,
-    Puara::style.handler   = style_get_handler,
-    Puara::style.user_ctx  = (char*)"/spiffs/style.css";
+void Puara::render_template(const pageTemplate& page, templateWriter writer, 
+                            const void* context, responseStream& stream) {
+    for (const auto& segment : page.segments) {
+        if (segment.field < 0) {
+            stream_write(stream, page.source.data() + segment.offset, segment.length);
+        } else {
+            writer(segment.field, context, stream);
+        }
+    }
+}
 
-    // Puara::factory.uri = "/factory.html";
-    // Puara::factory.method    = HTTP_GET,
-    // Puara::factory.handler   = get_handler,
-    // Puara::factory.user_ctx  = (char*)"/spiffs/factory.html";
+void Puara::write_index_field(int field, const void* context, responseStream& stream) {
+    const indexPage* page = static_cast<const indexPage*>(context);
+    // Put the module info on the HTML while sending the response
+    switch (field) {
+        case TEMPLATE_DMINAME:
+            stream_write(stream, page->dmiName);
+            break;
+        case TEMPLATE_STATUS:
+            if (Puara::StaIsConnected) {
+                stream_write(stream, "Currently connected on <strong style=\"color:Tomato;\">");
+                stream_write(stream, page->wifiSSID);
+                stream_write(stream, "</strong> network");
+            } else {
+                stream_write(stream, "Currently not connected to any network");
+            }
+            break;
+        case TEMPLATE_CURRENTSSID:
+            stream_write(stream, Puara::currentSSID);
+            break;
+        case TEMPLATE_CURRENTPSK:
+            stream_write(stream, page->wifiPSK);
+            break;
+        case TEMPLATE_CURRENTPERSISTENT:
+            if (page->persistentAP) {
+                stream_write(stream, "checked");
+            }
+            break;
+        case TEMPLATE_DEVICENAME:
+            stream_write(stream, page->device);
+            break;
+        case TEMPLATE_CURRENTOSC1:
+            stream_write(stream, page->oscIP1);
+            break;
+        case TEMPLATE_CURRENTPORT1:
+            stream_printf(stream, "%u", page->oscPORT1);
+            break;
+        case TEMPLATE_CURRENTOSC2:
+            stream_write(stream, page->oscIP2);
+            break;
+        case TEMPLATE_CURRENTPORT2:
+            stream_printf(stream, "%u", page->oscPORT2);
+            break;
+        case TEMPLATE_CURRENTLOCALPORT:
+            stream_printf(stream, "%u", page->localPORT);
+            break;
+        case TEMPLATE_CURRENTDESTINATIONS:
+            stream_write(stream, page->oscDestinations);
+            break;
+        case TEMPLATE_CURRENTSSID2:
+            stream_write(stream, page->wifiSSID);
+            break;
+        case TEMPLATE_CURRENTIP:
+            stream_write(stream, Puara::currentSTA_IP);
+            break;
+        case TEMPLATE_CURRENTAPIP:
+            stream_write(stream, Puara::currentAP_IP);
+            break;
+        case TEMPLATE_CURRENTSTAMAC:
+            stream_write(stream, Puara::currentSTA_MAC);
+            break;
+        case TEMPLATE_CURRENTAPMAC:
+            stream_write(stream, Puara::currentAP_MAC);
+            break;
+        case TEMPLATE_MODULEID:
+            stream_printf(stream, "%03x", page->id);
+            break;
+        case TEMPLATE_MODULEAUTH:
+            stream_write(stream, page->author);
+            break;
+        case TEMPLATE_MODULEINST:
+            stream_write(stream, page->institution);
+            break;
+        case TEMPLATE_MODULEVER:
+            stream_printf(stream, "%u", Puara::version);
+            break;
+        default:
+            break;
+    }
+}
 
-    Puara::reboot.uri = "/reboot.html";
-    Puara::reboot.method    = HTTP_GET,
-    Puara::reboot.handler   = get_handler,
-    Puara::reboot.user_ctx  = (char*)"/spiffs/reboot.html";
+esp_err_t Puara::index_get_handler(httpd_req_t *req) {
 
-    Puara::scan.uri = "/scan.html";
-    Puara::scan.method    = HTTP_GET,
-    Puara::scan.handler   = scan_get_handler,
-    Puara::scan.user_ctx  = (char*)"/spiffs/scan.html";
+    char etag[40];
+    if (check_page_not_modified(req, index_template, etag, sizeof(etag))) {
+        return ESP_OK;
+    }
+    indexPage page;
+    {
+        std::lock_guard<std::mutex> lock(config_mutex);
+        page = {dmiName, wifiSSID, wifiPSK, persistentAP, device, oscIP1, oscPORT1, oscIP2, oscPORT2,
+                localPORT, oscDestinations, id, author, institution};
+    }
+    responseStream stream = {req, 0, ESP_OK};
+    render_template(index_template, write_index_field, &page, stream);
 
-    // Puara::update.uri = "/update.html";
-    // Puara::update.method    = HTTP_GET,
+    return stream_finish(stream);
+}
+
+void Puara::write_settings_field(int field, const void* context, responseStream& stream) {
+    const settingsRow* row = static_cast<const settingsRow*>(context);
+    const settingsStore& variables = *row->variables;
+    switch (field) {
+        case TEMPLATE_DATAFROMMODULE:
+            for (size_t i = 0; i < variables.size(); i++) {
+                settingsRow item = {row->variables, i};
+                if (variables.types[i] == SETTING_TEXT) {
+                    render_template(settings_text_row, write_settings_field, &item, stream);
+                } else {
+                    render_template(settings_number_row, write_settings_field, &item, stream);
+                }
+            }
+            break;
+        case TEMPLATE_PARAMETER:
+            stream_write(stream, variables.name(row->index));
+            break;
+        case TEMPLATE_PARAMETERVALUE:
+            if (variables.types[row->index] == SETTING_TEXT) {
+                stream_write(stream, variables.text(row->index));
+            } else {
+                stream_printf(stream, "%.17g", variables.numbers[row->index]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+esp_err_t Puara::settings_get_handler(httpd_req_t *req) {
+
+    char etag[40];
+    if (check_page_not_modified(req, settings_template, etag, sizeof(etag))) {
+        return ESP_OK;
+    }
+    std::cout << "settings_get_handler: Adding variables to HTML" << std::endl;
+    // Rendered from a copy: holding the guard across the network send would
+    // stall publish_settings() for as long as the client takes
+    settingsStore variables;
+    {
+        settingsReadGuard guard;
+        variables = guard->variables;
+    }
+    responseStream stream = {req, 0, ESP_OK};
+    settingsRow page = {&variables, 0};
+    render_template(settings_template, write_settings_field, &page, stream);
+    
+    return stream_finish(stream);
+}
+
+void Puara::formDecoder::begin(void (*field_handler)(void* context, std::string_view key, std::string_view value), 
+                              void* field_context) {
+    handler = field_handler;
+    context = field_context;
+    field.clear();
+    too_long.clear();
+    key_length = 0;
+    in_value = false;
+    overflow = false;
+    escape = 0;
+}
+
+void Puara::formDecoder::append(char c) {
+    if (field.length() >= PUARA_FORM_FIELD_SIZE) {
+        overflow = true;
+        return;
+    }
+    field.push_back(c);
+}
+
+void Puara::formDecoder::flush_escape() {
+    // a '%' not followed by two hex digits is kept as sent
+    if (escape > 0) {
+        append('%');
+    }
+    if (escape > 1) {
+        append(escape_digit);
+    }
+    escape = 0;
+}
+
+void Puara::formDecoder::emit() {
+    flush_escape();
+    if (!in_value) {
+        key_length = field.length();
+    }
+    if (overflow) {
+        std::cout << "form: Field longer than " << PUARA_FORM_FIELD_SIZE << " bytes ignored" << std::endl;
+        too_long.emplace_back(field, 0, MIN(key_length, field.length()));
+    } else if (!field.empty()) {
+        // std::string keeps the value null-terminated
+        std::string_view text(field);
+        handler(context, text.substr(0, key_length), text.substr(key_length));
+    }
+    field.clear();
+    key_length = 0;
+    in_value = false;
+    overflow = false;
+}
+
+void Puara::formDecoder::feed(const char* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        char c = data[i];
+        if (escape > 0) {
+            if (isxdigit(static_cast<unsigned char>(c))) {
+                if (escape == 1) {
+                    escape_digit = c;
+                    escape = 2;
+                } else {
+                    char hex[3] = {escape_digit, c, '\0'};
+                    escape = 0;
+                    append(static_cast<char>(strtol(hex, nullptr, 16)));
+                }
+                continue;
+            }
+            flush_escape();
+        }
+        switch (c) {
+            case '&':
+                emit();
+                break;
+            case '=':
+                if (in_value) {
+                    append(c);
+                } else {
+                    key_length = field.length();
+                    in_value = true;
+                }
+                break;
+            case '+':
+                append(' ');
+                break;
+            case '%':
+                escape = 1;
+                break;
+            default:
+                append(c);
+                break;
+        }
+    }
+}
+
+void Puara::formDecoder::finish() {
+    emit();
+}
+
+esp_err_t Puara::receive_form(httpd_req_t *req, formDecoder& form) {
+    char buf[200];
+    int api_return, remaining = req->content_len;
+
+    while (remaining > 0) {
+        /* Read the data for the request */
+        if ((api_return = httpd_req_recv(req, buf,
+                        MIN(remaining, sizeof(buf)))) <= 0) {
+            if (api_return == HTTPD_SOCK_ERR_TIMEOUT) {
+                /* Retry receiving if timeout occurred */
+                continue;
+            }
+            return ESP_FAIL;
+        }
+        form.feed(buf, api_return);
+        remaining -= api_return;
+    }
+    form.finish();
+    if (!form.too_long.empty()) {
+        std::string message = "Form field too long: " + form.too_long.front();
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, message.c_str());
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+void Puara::settings_form_field(void* context, std::string_view key, std::string_view value) {
+    std::vector<jsonField>* fields = static_cast<std::vector<jsonField>*>(context);
+    fields->push_back({std::string(key), false, std::string(value), 0});
+}
+
+esp_err_t Puara::settings_post_handler(httpd_req_t *req) {
+    // The body is staged first: a slow client must not hold up other writers
+    std::vector<jsonField> fields;
+    formDecoder form;
+    form.begin(settings_form_field, &fields);
+    if (receive_form(req, form) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    // All fields of the form are published as one update
+    std::unique_lock<std::mutex> lock(settings_write_mutex);
+    std::unique_ptr<settingsSnapshot> next = copy_settings();
+    std::cout << "Settings stored:" << std::endl;
+    for (const auto& staged : fields) {
+        int field = next->variables.find(staged.name);
+        if (field < 0) {
+            std::cout << "Error, no match for setting to store received data: " << staged.name << std::endl;
+            continue;
+        }
+        std::cout << staged.name << ": " << staged.text << std::endl;
+        if (next->variables.types[field] == SETTING_TEXT) {
+            next->variables.set_text(field, staged.text);
+        } else {
+            next->variables.numbers[field] = strtod(staged.text.c_str(), nullptr);
+        }
+    }
+    std::cout << std::endl;
+    publish_settings(std::move(next), false);
+    lock.unlock();
+    config_generation++;
+
+    save_settings();
+
+    return send_asset(req, "/spiffs/saved.html");
+}
+
+esp_err_t Puara::get_handler(httpd_req_t *req) {
+
+    return send_asset(req, (const char*) req->user_ctx);
+}
+
+esp_err_t Puara::style_get_handler(httpd_req_t *req) {
+
+    httpd_resp_set_type(req, "text/css");
+    return send_asset(req, (const char*) req->user_ctx);
+}
+
+const puaraAsset* Puara::find_embedded_asset(const std::string& path) {
+    std::size_t name_position = path.rfind('/');
+    const char* name = path.c_str() + (name_position == std::string::npos ? 0 : name_position + 1);
+    for (std::size_t i = 0; i < puara_assets_count; i++) {
+        if (strcmp(puara_assets[i].name, name) == 0) {
+            return &puara_assets[i];
+        }
+    }
+    return nullptr;
+}
+
+esp_err_t Puara::send_asset(httpd_req_t *req, const std::string& path) {
+
+    // Pages embedded in the firmware are sent straight from flash
+    const puaraAsset* embedded = find_embedded_asset(path);
+    if (embedded) {
+        httpd_resp_set_type(req, embedded->mime_type);
+        if (check_not_modified(req, embedded->etag, static_cache_control)) {
+            return ESP_OK;
+        }
+        if (embedded->gzipped) {
+            httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+        }
+        httpd_resp_send(req, reinterpret_cast<const char*>(embedded->data), embedded->length);
+        return ESP_OK;
+    }
+
+    std::shared_ptr<const std::string> contents = get_asset(path);
+    if (!contents) {
+        std::cout << "http (spiffs): Could not find " << path << std::endl;
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, NULL);
+        return ESP_FAIL;
+    }
+    std::string etag = "\"" + content_etag(*contents) + "\"";
+    if (check_not_modified(req, etag.c_str(), static_cache_control)) {
+        return ESP_OK;
+    }
+    httpd_resp_send(req, contents->data(), contents->length());
+
+    return ESP_OK;
+}
+
+std::string Puara::content_etag(std::string_view contents) {
+    // 64-bit FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : contents) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", (unsigned long long) hash);
+    return hex;
+}
+
+bool Puara::etag_listed(std::string_view if_none_match, std::string_view etag) {
+    // If-None-Match is "*" or a comma-separated list of entity tags, compared
+    // weakly (RFC 9110 13.1.2): a W/ prefix on either side is ignored
+    if (etag.substr(0, 2) == "W/") {
+        etag.remove_prefix(2);
+    }
+    while (!if_none_match.empty()) {
+        size_t comma = if_none_match.find(',');
+        std::string_view entry = if_none_match.substr(0, comma);
+        if_none_match.remove_prefix(comma == std::string_view::npos ? if_none_match.size() : comma + 1);
+        size_t first = entry.find_first_not_of(" \t");
+        if (first == std::string_view::npos) {
+            continue;
+        }
+        entry = entry.substr(first, entry.find_last_not_of(" \t") - first + 1);
+        if (entry == "*") {
+            return true;
+        }
+        if (entry.substr(0, 2) == "W/") {
+            entry.remove_prefix(2);
+        }
+        if (entry == etag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Puara::check_not_modified(httpd_req_t *req, const char* etag, const char* cache_control) {
+    // Only GETs are cacheable, POST handlers reuse send_asset for their answer
+    if (req->method != HTTP_GET) {
+        return false;
+    }
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", cache_control);
+
+    size_t header_length = httpd_req_get_hdr_value_len(req, "If-None-Match");
+    if (header_length == 0) {
+        return false;
+    }
+    std::string if_none_match(header_length + 1, '\0');
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match.data(), if_none_match.size()) != ESP_OK) {
+        return false;
+    }
+    if_none_match.resize(header_length);
+    if (!etag_listed(if_none_match, etag)) {
+        return false;
+    }
+    httpd_resp_set_status(req, "304 Not Modified");
+    httpd_resp_send(req, NULL, 0);
+    return true;
+}
+
+bool Puara::check_page_not_modified(httpd_req_t *req, const pageTemplate& page, char* etag, size_t size) {
+    // httpd keeps the header pointer until the response is sent, so etag
+    // lives in the caller's frame
+    snprintf(etag, size, "\"%s-%u\"", page.etag.c_str(), config_generation.load());
+    // rendered pages are revalidated on every load
+    return check_not_modified(req, etag, "no-cache");
+}
+
+void Puara::write_scan_field(int field, const void* context, responseStream& stream) {
+    if (field == TEMPLATE_SSIDS) {
+        stream_write(stream, wifiAvailableSsid);
+    }
+}
+
+esp_err_t Puara::scan_get_handler(httpd_req_t *req) {
+
+    // a fresh scan runs on every request, so this page is never cached
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    wifi_scan();
+    responseStream stream = {req, 0, ESP_OK};
+    render_template(scan_template, write_scan_field, NULL, stream);
+
+    return stream_finish(stream);
+}
+
+// esp_err_t Puara::update_get_handler(httpd_req_t *req) {
+
+//     const char* resp_str = (const char*) req->user_ctx;
+//     Puara::mount_spiffs();
+//     std::cout << "http (spiffs): Reading update.html file" << std::endl;
+//     std::ifstream in(resp_str);
+//     std::string contents((std::istreambuf_iterator<char>(in)), 
+//     std::istreambuf_iterator<char>());
+//     //httpd_resp_set_type(req, "text/html");
+//     httpd_resp_sendstr(req, contents.c_str());
+    
+//     Puara::unmount_spiffs();
+
+//     return ESP_OK;
+// }
+
+void Puara::index_form_field(void* context, std::string_view key, std::string_view value) {
+    // Only collected here: the fields are applied under config_mutex once the
+    // whole body has arrived
+    configForm* form = static_cast<configForm*>(context);
+    auto config_field = config_fields.find(std::string(key));
+    if (config_field == config_fields.end()) {
+        std::cout << "Error, no match for config field to store received data: " << key << std::endl;
+        return;
+    }
+    form->fields.emplace_back(config_field->second, std::string(value));
+}
+
+void Puara::apply_index_form_field(configForm* form, int field, std::string_view value) {
+    switch (field) {
+        case 1:
+            std::cout << "SSID: " << value << std::endl;
+            if ( !value.empty() ) { 
+                wifiSSID = value;
+            } else {
+                std::cout << "SSID empty! Keeping the stored value" << std::endl;
+            }
+            break;
+        case 2:
+            std::cout << "APpasswd: " << value << std::endl;
+            if ( !value.empty() ) { 
+                APpasswdVal1 = value; 
+            } else {
+                std::cout << "APpasswd empty! Keeping the stored value" << std::endl;
+                APpasswdVal1.clear();
+            };
+            break;
+        case 3:
+            std::cout << "APpasswdValidate: " << value << std::endl;
+            if ( !value.empty() ) { 
+                APpasswdVal2 = value;
+            } else {
+                std::cout << "APpasswdValidate empty! Keeping the stored value" << std::endl;
+                APpasswdVal2.clear();
+            };
+            break;
+        case 4:
+            std::cout << "oscIP1: " << value << std::endl;
+            if ( !value.empty() ) {
+                oscIP1 = value;
+            } else {
+                std::cout << "oscIP1 empty! Keeping the stored value" << std::endl;
+            }
+            break;
+        case 5:
+            std::cout << "oscPORT1: " << value << std::endl;
+            if ( !value.empty() ) {
+                oscPORT1 = atoi(value.data());
+            } else {
+                std::cout << "oscPORT1 empty! Keeping the stored value" << std::endl;
+            }
+            break;
+        case 6:
+            std::cout << "oscIP2: " << value << std::endl;
+            if ( !value.empty() ) {
+                oscIP2 = value;
+            } else {
+                std::cout << "oscIP2 empty! Keeping the stored value" << std::endl;
+            }
+            break;
+        case 7:
+            std::cout << "oscPORT2: " << value << std::endl;
+            if ( !value.empty() ) {
+                oscPORT2 = atoi(value.data());
+            } else {
+                std::cout << "oscPORT2 empty! Keeping the stored value" << std::endl;
+            }
+            break;
+        case 8:
+            std::cout << "password: " << value << std::endl;
+            if ( !value.empty() ) { 
+                wifiPSK = value;
+            } else {
+                std::cout << "password empty! Keeping the stored value" << std::endl;
+            }
+            break;
+        case 9:
+            std::cout << "Rebooting\n";
+            form->reboot = true;
+            break;
+        case 10:
+            std::cout << "persistentAP: " << value << std::endl;
+            form->persistentAP = true;
+            break;
+        case 11:
+            std::cout << "localPORT: " << value << std::endl;
+            if ( !value.empty() ) {
+                localPORT = atoi(value.data());
+            } else {
+                std::cout << "localPORT empty! Keeping the stored value" << std::endl;
+            }
+            break;
+        case 12:
+            // an empty list is valid: it removes the extra destinations
+            std::cout << "oscDestinations: " << value << std::endl;
+            oscDestinations = value;
+            break;
+        default:
+            std::cout << "Error, no match for config field to store received data\n";
+            break; 
+    }
+}
+
+esp_err_t Puara::index_post_handler(httpd_req_t *req) {
+    configForm form_values = {false, false, {}};
+    formDecoder form;
+    form.begin(index_form_field, &form_values);
+    if (receive_form(req, form) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    std::unique_lock<std::mutex> lock(config_mutex);
+    for (const auto& field : form_values.fields) {
+        apply_index_form_field(&form_values, field.first, field.second);
+    }
+
+    // processing some post info
+    if ( APpasswdVal1 == APpasswdVal2 && APpasswdVal1.length() > 7 && APpasswdVal1.length() < 64 ) {
+        APpasswd = APpasswdVal1;
+        std::cout << "Puara password changed!\n";
+    } else {
+        std::cout << "Puara password doesn't match or isn't 8 to 63 characteres long. Passwork not changed.\n";
+    }
+    persistentAP = form_values.persistentAP;
+    APpasswdVal1.clear(); APpasswdVal2.clear();
+    config_generation++;
+    resolve_osc_destinations();
+    lock.unlock();
+
+    if (form_values.reboot) {
+        send_asset(req, "/spiffs/reboot.html");
+        std::cout <<  "\nRebooting...\n" << std::endl;
+        xTaskCreate(&Puara::reboot_with_delay, "reboot_with_delay", 4096, NULL, 10, NULL);
+        return ESP_OK;
+    } else {
+        save_config();
+        return send_asset(req, "/spiffs/saved.html");
+    }
+}
+
+void Puara::stream_json_string(responseStream& stream, std::string_view text) {
+    stream_write(stream, "\"", 1);
+    size_t start = 0;
+    for (size_t i = 0; i < text.length(); i++) {
+        unsigned char c = text[i];
+        if (c != '"' && c != '\\' && c >= 0x20) {
+            continue;
+        }
+        stream_write(stream, text.data() + start, i - start);
+        if (c == '"' || c == '\\') {
+            char escaped[2] = {'\\', static_cast<char>(c)};
+            stream_write(stream, escaped, 2);
+        } else {
+            stream_printf(stream, "\\u%04x", c);
+        }
+        start = i + 1;
+    }
+    stream_write(stream, text.data() + start, text.length() - start);
+    stream_write(stream, "\"", 1);
+}
+
+void Puara::stream_config_json(responseStream& stream, bool secrets) {
+    const char* separator = "{\"";
+    std::vector<jsonField> fields = config_snapshot();
+    for (size_t i = 0; i < fields.size(); i++) {
+        // config_snapshot() lists the fields in config_keys order
+        if (!secrets && config_keys[i].secret) {
+            continue;
+        }
+        const jsonField& field = fields[i];
+        stream_write(stream, separator);
+        stream_write(stream, field.name);
+        stream_write(stream, "\":");
+        if (field.is_number) {
+            stream_printf(stream, "%u", static_cast<unsigned int>(field.number));
+        } else {
+            stream_json_string(stream, field.text);
+        }
+        separator = ",\"";
+    }
+    stream_write(stream, "}");
+}
+
+void Puara::stream_settings_json(responseStream& stream) {
+    settingsReadGuard guard;
+    const settingsStore& variables = guard->variables;
+    stream_write(stream, "{\"settings\":[");
+    for (size_t i = 0; i < variables.size(); i++) {
+        stream_write(stream, i == 0 ? "{\"name\":" : ",{\"name\":");
+        stream_json_string(stream, variables.name(i));
+        stream_write(stream, ",\"value\":");
+        if (variables.types[i] == SETTING_TEXT) {
+            stream_json_string(stream, variables.text(i));
+        } else {
+            stream_printf(stream, "%.15g", variables.numbers[i]);
+        }
+        stream_write(stream, "}");
+    }
+    stream_write(stream, "]}");
+}
+
+esp_err_t Puara::receive_json(httpd_req_t *req, jsonCollector& collector, bool settings) {
+    char buf[200];
+    int api_return, remaining = req->content_len;
+
+    if (remaining > PUARA_API_MAX_BODY) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Request body too large");
+        return ESP_FAIL;
+    }
+    jsonStream parser;
+    collector.in_settings = false;
+    collector.current_too_long = false;
+    parser.begin(settings ? collect_settings_field : collect_config_field, &collector);
+    while (remaining > 0) {
+        /* Read the data for the request */
+        if ((api_return = httpd_req_recv(req, buf,
+                        MIN(remaining, sizeof(buf)))) <= 0) {
+            if (api_return == HTTPD_SOCK_ERR_TIMEOUT) {
+                /* Retry receiving if timeout occurred */
+                continue;
+            }
+            return ESP_FAIL;
+        }
+        parser.feed(buf, api_return);
+        remaining -= api_return;
+    }
+    if (!parser.finish()) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed JSON");
+        return ESP_FAIL;
+    }
+    if (!collector.too_long.empty()) {
+        std::string message = "Field too long: " + collector.too_long.front();
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, message.c_str());
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t Puara::api_config_get_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
+    responseStream stream = {req, 0, ESP_OK};
+    stream_config_json(stream, false);
+    return stream_finish(stream);
+}
+
+esp_err_t Puara::api_config_put_handler(httpd_req_t *req) {
+    jsonCollector collector;
+    if (receive_json(req, collector, false) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    // Reject the whole request before applying anything
+    static_assert(sizeof(config_keys) / sizeof(config_keys[0]) < 32, "config keys are tracked in a 32-bit mask");
+    uint32_t seen = 0;
+    for (const auto& field : collector.fields) {
+        const configKey* key = nullptr;
+        for (size_t i = 0; i < config_keys_count; i++) {
+            if (config_keys[i].name == field.name) {
+                key = &config_keys[i];
+                seen |= 1u << i;
+                break;
+            }
+        }
+        if (key == nullptr || key->is_number != field.is_number) {
+            std::string message = (key == nullptr ? "Unknown config field: " : "Wrong type for config field: ") + field.name;
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, message.c_str());
+            return ESP_FAIL;
+        }
+        // WPA2 passphrases are 8 to 63 characters, as on the config page
+        if (field.name == "APpasswd" && (field.text.length() < 8 || field.text.length() > 63)) {
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "APpasswd must be 8 to 63 characters");
+            return ESP_FAIL;
+        }
+        if ((field.name == "oscPORT1" || field.name == "oscPORT2" || field.name == "localPORT") &&
+            (field.number < 1 || field.number > 65535 || field.number != static_cast<unsigned int>(field.number))) {
+            std::string message = field.name + " must be a port from 1 to 65535";
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, message.c_str());
+            return ESP_FAIL;
+        }
+        // an empty address leaves the destination unset
+        struct in_addr address;
+        if ((field.name == "oscIP1" || field.name == "oscIP2") && !field.text.empty() &&
+            inet_pton(AF_INET, field.text.c_str(), &address) != 1) {
+            std::string message = field.name + " must be an IPv4 address";
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, message.c_str());
+            return ESP_FAIL;
+        }
+    }
+    // The secrets are never returned by GET, so a PUT of what GET returned
+    // keeps them
+    uint32_t required = 0;
+    for (size_t i = 0; i < config_keys_count; i++) {
+        if (!config_keys[i].secret) {
+            required |= 1u << i;
+        }
+    }
+    if (req->method == HTTP_PUT && (seen & required) != required) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "PUT needs every config field, use PATCH for partial updates");
+        return ESP_FAIL;
+    }
+
+    std::cout << "api: Updating " << collector.fields.size() << " config fields" << std::endl;
+    apply_config_fields(collector.fields);
+    save_config();
+    return api_config_get_handler(req);
+}
+
+esp_err_t Puara::api_settings_get_handler(httpd_req_t *req) {
+    httpd_resp_set_type(req, "application/json");
+    responseStream stream = {req, 0, ESP_OK};
+    stream_settings_json(stream);
+    return stream_finish(stream);
+}
+
+esp_err_t Puara::api_settings_put_handler(httpd_req_t *req) {
+    jsonCollector collector;
+    if (receive_json(req, collector, true) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    // PATCH may only change existing settings, PUT replaces the whole list
+    bool merge = (req->method == HTTP_PATCH);
+    if (merge) {
+        settingsReadGuard guard;
+        for (const auto& field : collector.fields) {
+            int existing = guard->variables.find(field.name);
+            if (existing < 0 || (guard->variables.types[existing] == SETTING_NUMBER) != field.is_number) {
+                std::string message = (existing < 0 ? "Unknown setting: " : "Wrong type for setting: ") + field.name;
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, message.c_str());
+                return ESP_FAIL;
+            }
+        }
+    }
+
+    std::cout << "api: Updating " << collector.fields.size() << " settings" << std::endl;
+    apply_settings_fields(collector.fields, merge);
+    save_settings();
+    return api_settings_get_handler(req);
+}
+
+httpd_handle_t Puara::start_webserver(void) {
+    
+    if (!ApStarted) {
+        std::cout << "start_webserver: Cannot start webserver: AP and STA not initializated" << std::endl;
+        return NULL;
+    }
+    Puara::webserver = NULL;
+    Puara::compile_templates();
+
+    Puara::webserver_config.task_priority      = tskIDLE_PRIORITY+5;
+    Puara::webserver_config.stack_size         = 4096;
+    Puara::webserver_config.core_id            = tskNO_AFFINITY;
+    Puara::webserver_config.server_port        = 80;
+    Puara::webserver_config.ctrl_port          = 32768;
+    Puara::webserver_config.max_open_sockets   = 7;
+    Puara::webserver_config.max_uri_handlers   = 16;
+    Puara::webserver_config.max_resp_headers   = 16;
+    Puara::webserver_config.backlog_conn       = 5;
+    Puara::webserver_config.lru_purge_enable   = true;
+    Puara::webserver_config.recv_wait_timeout  = 5;
+    Puara::webserver_config.send_wait_timeout  = 5;
+    Puara::webserver_config.global_user_ctx = NULL;
+    Puara::webserver_config.global_user_ctx_free_fn = NULL;
+    Puara::webserver_config.global_transport_ctx = NULL;
+    Puara::webserver_config.global_transport_ctx_free_fn = NULL;
+    Puara::webserver_config.open_fn = NULL;
+    Puara::webserver_config.close_fn = NULL;
+    Puara::webserver_config.uri_match_fn = NULL;
+
+    Puara::index.uri = "/";
+    Puara::index.method    = HTTP_GET,
+    Puara::index.handler   = index_get_handler,
+    Puara::index.user_ctx  = (char*)"/spiffs/index.html";
+
+    Puara::indexpost.uri = "/";
+    Puara::indexpost.method    = HTTP_POST,
+    Puara::indexpost.handler   = index_post_handler,
+    Puara::indexpost.user_ctx  = (char*)"/spiffs/index.html";
+
+    Puara::style.uri = "/style.css";
+    Puara::style.method    = HTTP_GET,
+    Puara::style.handler   = style_get_handler,
+    Puara::style.user_ctx  = (char*)"/spiffs/style.css";
+
+    // Puara::factory.uri = "/factory.html";
+    // Puara::factory.method    = HTTP_GET,
+    // Puara::factory.handler   = get_handler,
+    // Puara::factory.user_ctx  = (char*)"/spiffs/factory.html";
+
+    Puara::reboot.uri = "/reboot.html";
+    Puara::reboot.method    = HTTP_GET,
+    Puara::reboot.handler   = get_handler,
+    Puara::reboot.user_ctx  = (char*)"/spiffs/reboot.html";
+
+    Puara::scan.uri = "/scan.html";
+    Puara::scan.method    = HTTP_GET,
+    Puara::scan.handler   = scan_get_handler,
+    Puara::scan.user_ctx  = (char*)"/spiffs/scan.html";
+
+    // Puara::update.uri = "/update.html";
+    // Puara::update.method    = HTTP_GET,
     // Puara::update.handler   = get_handler,
     // Puara::update.user_ctx  = (char*)"/spiffs/update.html";
 
-    Puara::settings.uri = "/settings.html";
-    Puara::settings.method    = HTTP_GET,
-    Puara::settings.handler   = settings_get_handler,
-    Puara::settings.user_ctx  = (char*)"/spiffs/settings.html";
+    Puara::settings.uri = "/settings.html";
+    Puara::settings.method    = HTTP_GET,
+    Puara::settings.handler   = settings_get_handler,
+    Puara::settings.user_ctx  = (char*)"/spiffs/settings.html";
+
+    Puara::settingspost.uri = "/settings.html";
+    Puara::settingspost.method    = HTTP_POST,
+    Puara::settingspost.handler   = settings_post_handler,
+    Puara::settingspost.user_ctx  = (char*)"/spiffs/settings.html";
+
+    Puara::apiconfig.uri = "/api/config";
+    Puara::apiconfig.method    = HTTP_GET,
+    Puara::apiconfig.handler   = api_config_get_handler,
+    Puara::apiconfig.user_ctx  = NULL;
+
+    Puara::apiconfigput.uri = "/api/config";
+    Puara::apiconfigput.method    = HTTP_PUT,
+    Puara::apiconfigput.handler   = api_config_put_handler,
+    Puara::apiconfigput.user_ctx  = NULL;
+
+    Puara::apiconfigpatch.uri = "/api/config";
+    Puara::apiconfigpatch.method    = HTTP_PATCH,
+    Puara::apiconfigpatch.handler   = api_config_put_handler,
+    Puara::apiconfigpatch.user_ctx  = NULL;
+
+    Puara::apisettings.uri = "/api/settings";
+    Puara::apisettings.method    = HTTP_GET,
+    Puara::apisettings.handler   = api_settings_get_handler,
+    Puara::apisettings.user_ctx  = NULL;
+
+    Puara::apisettingsput.uri = "/api/settings";
+    Puara::apisettingsput.method    = HTTP_PUT,
+    Puara::apisettingsput.handler   = api_settings_put_handler,
+    Puara::apisettingsput.user_ctx  = NULL;
+
+    Puara::apisettingspatch.uri = "/api/settings";
+    Puara::apisettingspatch.method    = HTTP_PATCH,
+    Puara::apisettingspatch.handler   = api_settings_put_handler,
+    Puara::apisettingspatch.user_ctx  = NULL;
+
+#ifdef PUARA_BOOT_PROFILE
+    Puara::apimetrics.uri = "/api/metrics";
+    Puara::apimetrics.method    = HTTP_GET,
+    Puara::apimetrics.handler   = api_metrics_get_handler,
+    Puara::apimetrics.user_ctx  = NULL;
+#endif
+
+    // Start the httpd server
+    std::cout << "webserver: Starting server on port: " << webserver_config.server_port << std::endl;
+    if (httpd_start(&webserver, &webserver_config) == ESP_OK) {
+        // Set URI handlers
+        std::cout << "webserver: Registering URI handlers" << std::endl;
+        httpd_register_uri_handler(webserver, &index);
+        httpd_register_uri_handler(webserver, &indexpost);
+        httpd_register_uri_handler(webserver, &style);
+        httpd_register_uri_handler(webserver, &scan);
+        //httpd_register_uri_handler(webserver, &factory);
+        httpd_register_uri_handler(webserver, &reboot);
+        // httpd_register_uri_handler(webserver, &update);
+        httpd_register_uri_handler(webserver, &settings);
+        httpd_register_uri_handler(webserver, &settingspost);
+        httpd_register_uri_handler(webserver, &apiconfig);
+        httpd_register_uri_handler(webserver, &apiconfigput);
+        httpd_register_uri_handler(webserver, &apiconfigpatch);
+        httpd_register_uri_handler(webserver, &apisettings);
+        httpd_register_uri_handler(webserver, &apisettingsput);
+        httpd_register_uri_handler(webserver, &apisettingspatch);
+#ifdef PUARA_BOOT_PROFILE
+        httpd_register_uri_handler(webserver, &apimetrics);
+#endif
+        return webserver;
+    }
+
+    std::cout << "webserver: Error starting server!" << std::endl;
+    return NULL;
+}
+
+void Puara::stop_webserver(void) {
+    // Stop the httpd server
+    httpd_stop(webserver);
+}
+
+void Puara::send_serial_data(std::string data) {
+    std::cout << Puara::data_start << data << Puara::data_end << std::endl;
+}
+
+static_assert((PUARA_SERIAL_RING_SIZE & (PUARA_SERIAL_RING_SIZE - 1)) == 0,
+              "PUARA_SERIAL_RING_SIZE must be a power of two");
+
+size_t Puara::serialRing::push(const char* data, size_t length) {
+    size_t current_head = head.load(std::memory_order_relaxed);
+    size_t free_space = PUARA_SERIAL_RING_SIZE - (current_head - tail.load(std::memory_order_acquire));
+    length = MIN(length, free_space);
+    for (size_t i = 0; i < length; i++) {
+        buffer[(current_head + i) & (PUARA_SERIAL_RING_SIZE - 1)] = data[i];
+    }
+    head.store(current_head + length, std::memory_order_release);
+    return length;
+}
+
+size_t Puara::serialRing::pop(char* data, size_t length) {
+    size_t current_tail = tail.load(std::memory_order_relaxed);
+    size_t used_space = head.load(std::memory_order_acquire) - current_tail;
+    length = MIN(length, used_space);
+    for (size_t i = 0; i < length; i++) {
+        data[i] = buffer[(current_tail + i) & (PUARA_SERIAL_RING_SIZE - 1)];
+    }
+    tail.store(current_tail + length, std::memory_order_release);
+    return length;
+}
+
+void Puara::serial_received(const char* data, size_t length) {
+    // Called from the monitor task only. When the ring is full we wait for
+    // interpret_serial to drain it rather than dropping input.
+    while (length > 0) {
+        size_t pushed = serial_ring.push(data, length);
+        data += pushed;
+        length -= pushed;
+        xTaskNotifyGive(serial_interpreter);
+        if (length > 0) {
+            vTaskDelay(1);
+        }
+    }
+}
+
+bool Puara::begin_transfer(std::string_view header, bool settings) {
+    // header is "<<<length crc32", with the CRC in hexadecimal
+    char text[32];
+    header.remove_prefix(data_start.length());
+    size_t text_length = MIN(header.length(), sizeof(text) - 1);
+    memcpy(text, header.data(), text_length);
+    text[text_length] = '\0';
+    char* end;
+    unsigned long length = strtoul(text, &end, 10);
+    unsigned long expected_crc = strtoul(end, &end, 16);
+    if (end == text || *end != '\0' || length == 0) {
+        send_serial_data("NAK bad header");
+        return false;
+    }
+
+    serial_transfer.active = true;
+    serial_transfer.settings = settings;
+    serial_transfer.remaining = length;
+    serial_transfer.trailer = 0;
+    serial_transfer.expected_crc = expected_crc;
+    serial_transfer.crc = 0;
+    serial_transfer.collector.fields.clear();
+    serial_transfer.collector.too_long.clear();
+    serial_transfer.collector.current_too_long = false;
+    serial_transfer.collector.in_settings = false;
+    serial_transfer.parser.begin(settings ? collect_settings_field : collect_config_field, 
+                                 &serial_transfer.collector);
+    return true;
+}
+
+size_t Puara::continue_transfer(const char* data, size_t length) {
+    size_t used = 0;
+    if (serial_transfer.remaining > 0) {
+        used = MIN(length, serial_transfer.remaining);
+        serial_transfer.crc = crc32(serial_transfer.crc, data, used);
+        serial_transfer.parser.feed(data, used);
+        serial_transfer.remaining -= used;
+    }
+    while (serial_transfer.remaining == 0 && used < length) {
+        if (data[used++] != data_end[serial_transfer.trailer]) {
+            end_transfer("missing end marker");
+            return used;
+        }
+        if (++serial_transfer.trailer == (int) data_end.length()) {
+            end_transfer(NULL);
+            return used;
+        }
+    }
+    return used;
+}
+
+void Puara::end_transfer(const char* error) {
+    char reply[80];
+    serial_transfer.active = false;
+    if (error == NULL && serial_transfer.crc != serial_transfer.expected_crc) {
+        error = "crc mismatch";
+    }
+    if (error == NULL && !serial_transfer.parser.finish()) {
+        error = "invalid json";
+    }
+    if (error == NULL && !serial_transfer.collector.too_long.empty()) {
+        // nothing is applied, as for the JSON API
+        snprintf(reply, sizeof(reply), "NAK too long: %.60s", serial_transfer.collector.too_long.front().c_str());
+    } else if (error) {
+        snprintf(reply, sizeof(reply), "NAK %s", error);
+    } else {
+        if (serial_transfer.settings) {
+            apply_settings_fields(serial_transfer.collector.fields, true);
+        } else {
+            apply_config_fields(serial_transfer.collector.fields);
+        }
+        snprintf(reply, sizeof(reply), "ACK %08x", (unsigned int) serial_transfer.crc);
+    }
+    serial_transfer.collector.fields.clear();
+    serial_transfer.collector.too_long.clear();
+    send_serial_data(reply);
+}
+
+void Puara::frame_serial(const char* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (serial_transfer.active) {
+            i += continue_transfer(data + i, length - i) - 1;
+            continue;
+        }
+        char c = data[i];
+        if (c == '\n' && serial_frame.depth == 0) {
+            if (!serial_frame.data.empty() && serial_frame.data.back() == '\r') {
+                serial_frame.data.pop_back();
+            }
+            if (!serial_frame.data.empty()) {
+                dispatch_serial(serial_frame.data);
+            }
+            serial_frame.data.clear();
+            serial_frame.quoted = serial_frame.escaped = false;
+            continue;
+        }
+        serial_frame.data.push_back(c);
+        // track JSON nesting so multi-line payloads stay in one command
+        if (serial_frame.escaped) {
+            serial_frame.escaped = false;
+        } else if (serial_frame.quoted) {
+            if (c == '\\') {
+                serial_frame.escaped = true;
+            } else if (c == '"') {
+                serial_frame.quoted = false;
+            }
+        } else if (c == '"' && serial_frame.depth > 0) {
+            serial_frame.quoted = true;
+        } else if (c == '{') {
+            serial_frame.depth++;
+        } else if (c == '}' && serial_frame.depth > 0) {
+            serial_frame.depth--;
+        }
+    }
+}
+
+void Puara::interpret_serial(void *pvParameters) {
+    char chunk[128];
+    while (1) {
+        // Sleep until the monitor task notifies new bytes. A partial command
+        // is dispatched once the line has been idle for PUARA_SERIAL_IDLE_MS,
+        // for hosts that do not terminate commands with a newline.
+        TickType_t wait = serial_transfer.active ? pdMS_TO_TICKS(PUARA_SERIAL_TRANSFER_TIMEOUT_MS) :
+                          serial_frame.data.empty() ? portMAX_DELAY : 
+                                                      pdMS_TO_TICKS(PUARA_SERIAL_IDLE_MS);
+        if (ulTaskNotifyTake(pdTRUE, wait) == 0) {
+            if (serial_transfer.active) {
+                end_transfer("timeout");
+            } else if (!serial_frame.data.empty()) {
+                dispatch_serial(serial_frame.data);
+                serial_frame.data.clear();
+                serial_frame.depth = 0;
+                serial_frame.quoted = serial_frame.escaped = false;
+            }
+            continue;
+        }
+        size_t length;
+        while ((length = serial_ring.pop(chunk, sizeof(chunk))) > 0) {
+            frame_serial(chunk, length);
+        }
+    }
+}
+
+void Puara::dispatch_serial(std::string_view command) {
+    std::size_t name_end = command.find_first_of(" \t\r\n");
+    std::string_view name = command.substr(0, name_end);
+    std::string_view arguments;
+    if (name_end != std::string_view::npos) {
+        arguments = command.substr(name_end);
+        arguments.remove_prefix(MIN(arguments.find_first_not_of(" \t\r\n"), arguments.length()));
+    }
+
+    const serialCommand* match = find_serial_command(name);
+    if (match) {
+        match->handler(arguments);
+    } else {
+        std::cout << "\nI don´t recognize the command \"" << command << "\""<< std::endl;
+    }
+}
+
+const Puara::serialCommand* Puara::find_serial_command(std::string_view name) {
+    if (name.empty()) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < serial_commands_count; i++) {
+        const serialCommand& command = serial_commands[i];
+        if (command.name.length() == name.length() && command.name[0] == name[0] && 
+            command.name == name) {
+            return &command;
+        }
+    }
+    size_t count = user_commands_count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+        const serialCommand& command = user_commands[i];
+        if (command.name.length() == name.length() && command.name[0] == name[0] && 
+            command.name == name) {
+            return &command;
+        }
+    }
+    return nullptr;
+}
+
+bool Puara::register_serial_command(std::string_view name, void (*handler)(std::string_view arguments)) {
+    std::lock_guard<std::mutex> lock(user_commands_mutex);
+    if (name.empty() || handler == nullptr || find_serial_command(name) != nullptr) {
+        std::cout << "serial: Cannot register command \"" << name << "\"" << std::endl;
+        return false;
+    }
+    size_t count = user_commands_count.load(std::memory_order_relaxed);
+    if (count == PUARA_SERIAL_USER_COMMANDS) {
+        std::cout << "serial: Command table full, cannot register \"" << name << "\"" << std::endl;
+        return false;
+    }
+    // the name must outlive the table entry, commands are never removed
+    char* stored_name = new char[name.length()];
+    memcpy(stored_name, name.data(), name.length());
+    user_commands[count] = {std::string_view(stored_name, name.length()), handler};
+    // publish the entry only once it is complete, interpret_serial reads without locking
+    user_commands_count.store(count + 1, std::memory_order_release);
+    return true;
+}
+
+void Puara::reboot_command(std::string_view /* arguments */) {
+    std::cout <<  "\nRebooting...\n" << std::endl;
+    xTaskCreate(&Puara::reboot_with_delay, "reboot_with_delay", 4096, NULL, 10, NULL);
+}
+
+void Puara::ping_command(std::string_view /* arguments */) {
+    std::cout << "pong\n";
+}
+
+void Puara::whatareyou_command(std::string_view /* arguments */) {
+    Puara::send_serial_data(Puara::dmiName);
+}
+
+void Puara::sendconfig_command(std::string_view arguments) {
+    if (arguments.substr(0, data_start.length()) == data_start) {
+        Puara::begin_transfer(arguments, false);
+    } else {
+        Puara::read_config_json_internal(arguments);
+    }
+}
+
+void Puara::writeconfig_command(std::string_view /* arguments */) {
+    Puara::write_config();
+}
+
+void Puara::readconfig_command(std::string_view /* arguments */) {
+    std::string contents;
+    responseStream stream = {NULL, 0, ESP_OK, &contents};
+    Puara::stream_config_json(stream, true);
+    Puara::send_serial_data(contents);
+}
+
+void Puara::sendsettings_command(std::string_view arguments) {
+    if (arguments.substr(0, data_start.length()) == data_start) {
+        Puara::begin_transfer(arguments, true);
+    } else {
+        Puara::read_settings_json_internal(arguments, true);
+    }
+}
+
+void Puara::writesettings_command(std::string_view /* arguments */) {
+    Puara::write_settings();
+}
+
+void Puara::readsettings_command(std::string_view /* arguments */) {
+    std::string contents;
+    responseStream stream = {NULL, 0, ESP_OK, &contents};
+    Puara::stream_settings_json(stream);
+    Puara::send_serial_data(contents);
+}
+
+    void Puara::uart_monitor(void *pvParameters) {
+        const int uart_num0 = 0; //UART port 0
+        uart_config_t uart_config0 = {
+            .baud_rate = 115200,
+            .data_bits = UART_DATA_8_BITS,
+            .parity = UART_PARITY_DISABLE,
+            .stop_bits = UART_STOP_BITS_1,
+            .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,    //UART_HW_FLOWCTRL_CTS_RTS,
+            .rx_flow_ctrl_thresh = 122,
+            .source_clk = UART_SCLK_APB,
+        };
+
+        //Configure UART1 parameters
+        uart_param_config(uart_num0, &uart_config0);
+
+        uart_set_pin(uart_num0, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+        
+        //Install UART driver (we don't need an event queue here)
+        //In this example we don't even use a buffer for sending data.
+        //The RX buffer holds bursts while interpret_serial drains the ring.
+        uart_driver_install(uart_num0, PUARA_SERIAL_BUFSIZE * 2, 0, 0, NULL, 0);
+
+        while(1) {
+            //Block until data arrives, then take everything already buffered
+            int length = uart_read_bytes(uart_num0, serial_data, 1, portMAX_DELAY);
+            if (length <= 0) {
+                continue;
+            }
+            size_t buffered = 0;
+            uart_get_buffered_data_len(uart_num0, &buffered);
+            if (buffered > 0) {
+                int extra = uart_read_bytes(uart_num0, serial_data + 1, 
+                                            MIN(buffered, sizeof(serial_data) - 1), 0);
+                if (extra > 0) {
+                    length += extra;
+                }
+            }
+            serial_received(serial_data, length);
+        }
+    }
+
+    void Puara::jtag_monitor(void *pvParameters) {
+        #if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
+        // Setup jtag module for USB Serial reads
+        usb_serial_jtag_driver_config_t jtag_config {
+            .tx_buffer_size = 256,
+            .rx_buffer_size = 256,
+        };
+
+        // Install jtag module
+        usb_serial_jtag_driver_install(&jtag_config);
+
+        while(1) {
+            // Only read if connected to PC, returns as soon as any data is available
+            int length = usb_serial_jtag_read_bytes(serial_data, PUARA_SERIAL_BUFSIZE, portMAX_DELAY);
+            if (length > 0) {
+                serial_received(serial_data, length);
+            }
+        }
+        #endif
+    }
+
+    void Puara::usb_monitor(void *pvParameters) {
+        #if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
+        // // Setup usb module for USB reads
+        // const char *product_name = dmiName.c_str();
+        // const char *manufacturer_name = author.c_str();
+
+        // tinyusb_device_config_t usb_config = {                                    
+        //     .vid = USB_ESPRESSIF_VID,                                       
+        //     .pid = 0x0002,                                                  
+        //     .product_name = product_name,                 
+        //     .manufacturer_name = manufacturer_name,       
+        //     .serial_number = product_name,                 
+        //     .fw_version = version,                        
+        //     .usb_version = 0x0200,                                          
+        //     .usb_class = TUSB_CLASS_MISC,                                   
+        //     .usb_subclass = MISC_SUBCLASS_COMMON,                           
+        //     .usb_protocol = MISC_PROTOCOL_IAD,                              
+        //     .usb_attributes = TUSB_DESC_CONFIG_ATT_SELF_POWERED,            
+        //     .usb_power_ma = 500,                                            
+        //     .webusb_enabled = false,                                        
+        //     .webusb_url = "espressif.github.io/arduino-esp32/webusb.html"   
+        // };
+
+        // // Setup USB interface
+        // tinyusb_init(&usb_config);
+        // TODO: Read from USB interface
+        std::cout << "USB OTG monitor not supported, use the USB Serial JTAG or UART interface" << std::endl;
+        #endif
+    }
+
+    bool Puara::start_serial_listening() {
+        //std::cout << "starting serial monitor \n";
+        // The interpreter must exist before the monitor can notify it
+        if (module_monitor == UART_MONITOR) {
+            xTaskCreate(interpret_serial, "interpret_serial", 4096, NULL, 10, &serial_interpreter);
+            xTaskCreate(uart_monitor, "serial_monitor", 2048, NULL, 10, NULL);
+        } else if (module_monitor == JTAG_MONITOR) {
+            xTaskCreate(interpret_serial, "interpret_serial", 4096, NULL, 10, &serial_interpreter);
+            xTaskCreate(jtag_monitor, "serial_monitor", 2048, NULL, 10, NULL);
+        } else if (module_monitor == USB_MONITOR) {
+            xTaskCreate(interpret_serial, "interpret_serial", 4096, NULL, 10, &serial_interpreter);
+            xTaskCreate(usb_monitor, "serial_monitor", 2048, NULL, 10, NULL);
+        } else {
+            std::cout << "Invalid Monitor Type" << std::endl;
+        }
+        return 1;
+    }
+
+void Puara::reboot_with_delay(void *pvParameter) {
+    vTaskDelay(reboot_delay / portTICK_RATE_MS);
+    // Pending saves are written by the persistence task, which has the stack
+    // for it and may already be in the middle of a write
+    if (persistence_task != NULL) {
+        flush_waiter = xTaskGetCurrentTaskHandle();
+        flush_requested = true;
+        xTaskNotifyGive(persistence_task);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    } else {
+        Puara::flush_changes();
+    }
+    // never restart in the middle of a write started from elsewhere
+    persistence_mutex.lock();
+    esp_restart();
+}
+
+void Puara::start_mdns_service(const char * device_name, const char * instance_name) {
+    //initialize mDNS service
+    esp_err_t err = mdns_init();
+    if (err) {
+        std::cout << "MDNS Init failed: " << err << std::endl;
+        return;
+    }
+    //set hostname
+    ESP_ERROR_CHECK(mdns_hostname_set(device_name));
+    //set default instance
+    ESP_ERROR_CHECK(mdns_instance_name_set(instance_name));
+    std::cout << "MDNS Init completed. Device name: " << device_name << "\n" << std::endl;
+}
+
+void Puara::start_mdns_service(std::string device_name, std::string instance_name) {
+    //initialize mDNS service
+    esp_err_t err = mdns_init();
+    if (err) {
+        std::cout << "MDNS Init failed: " << err << std::endl;
+        return;
+    }
+    //set hostname
+    ESP_ERROR_CHECK(mdns_hostname_set(device_name.c_str()));
+    //set default instance
+    ESP_ERROR_CHECK(mdns_instance_name_set(instance_name.c_str()));
+    std::cout << "MDNS Init completed. Device name: " << device_name << "\n" << std::endl;
+}
 
-    Puara::settingspost.uri = "/settings.html";
-    Puara::settingspost.method    = HTTP_POST,
-    Puara::settingspost.handler   = settings_post_handler,
-    Puara::settingspost.user_ctx  = (char*)"/spiffs/settings.html";
+void Puara::wifi_scan(void) {
 
-    // Start the httpd server
-    std::cout << "webserver: Starting server on port: " << webserver_config.server_port << std::endl;
-    if (httpd_start(&webserver, &webserver_config) == ESP_OK) {
-        // Set URI handlers
-        std::cout << "webserver: Registering URI handlers" << std::endl;
-        httpd_register_uri_handler(webserver, &index);
-        httpd_register_uri_handler(webserver, &indexpost);
-        httpd_register_uri_handler(webserver, &style);
-        httpd_register_uri_handler(webserver, &scan);
-        //httpd_register_uri_handler(webserver, &factory);
-        httpd_register_uri_handler(webserver, &reboot);
-        // httpd_register_uri_handler(webserver, &update);
-        httpd_register_uri_handler(webserver, &settings);
-        httpd_register_uri_handler(webserver, &settingspost);
-        return webserver;
+    uint16_t number = wifiScanSize;
+    wifi_ap_record_t ap_info[wifiScanSize];
+    uint16_t ap_count = 0;
+    memset(ap_info, 0, sizeof(ap_info));
+
+    esp_wifi_scan_start(NULL, true);
+    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&number, ap_info));
+    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_num(&ap_count));
+    std::cout << "wifi_scan: Total APs scanned = " << ap_count << std::endl;
+    wifiAvailableSsid.clear();
+    for (int i = 0; (i < wifiScanSize) && (i < ap_count); i++) {
+        wifiAvailableSsid.append("<strong>SSID: </strong>");
+        wifiAvailableSsid.append(reinterpret_cast<const char*>(ap_info[i].ssid));
+        wifiAvailableSsid.append("<br>      (RSSI: ");
+        wifiAvailableSsid.append(std::to_string(ap_info[i].rssi));
+        wifiAvailableSsid.append(", Channel: ");
+        wifiAvailableSsid.append(std::to_string(ap_info[i].primary));
+        wifiAvailableSsid.append(")<br>");
+    }
+}
+
+bool Puara::get_StaIsConnected() {
+    return StaIsConnected;
+}
+
+double Puara::getVarNumber(std::string varName) {
+    settingsReadGuard guard;
+    int index = guard->variables.find(varName);
+    if (index < 0) {
+        throw std::out_of_range("Unknown setting: " + varName);
+    }
+    return guard->variables.numbers[index];
+}
+        
+std::string Puara::getVarText(std::string varName) {
+    settingsReadGuard guard;
+    int index = guard->variables.find(varName);
+    if (index < 0) {
+        throw std::out_of_range("Unknown setting: " + varName);
+    }
+    return std::string(guard->variables.text(index));
+}
+
+SettingHandle<double> Puara::getVarNumberHandle(std::string varName) {
+    return SettingHandle<double>(varName);
+}
+
+SettingHandle<std::string> Puara::getVarTextHandle(std::string varName) {
+    return SettingHandle<std::string>(varName);
+}
+
+std::string Puara::getIP1() {
+    std::lock_guard<std::mutex> lock(config_mutex);
+    return oscIP1;
+}
+
+std::string Puara::getIP2() {
+    std::lock_guard<std::mutex> lock(config_mutex);
+    return oscIP2;
+}
+
+int unsigned Puara::getPORT1() {
+    return oscPORT1;
+}
+
+int unsigned Puara::getPORT2() {
+    return oscPORT2;
+}
+
+std::string Puara::getPORT1Str() {
+    return std::to_string(oscPORT1);
+}
+
+std::string Puara::getPORT2Str() {
+    return std::to_string(oscPORT2);
+}
+
+int unsigned Puara::getLocalPORT() {
+    return localPORT;
+}
+
+std::string Puara::getLocalPORTStr() {
+    return std::to_string(localPORT);
+}
+
+bool Puara::IP1_ready() {
+    return osc_destinations[0].route.load() != 0;
+}
+
+bool Puara::IP2_ready() {
+    return osc_destinations[1].route.load() != 0;
+}
+
+static size_t osc_padded(size_t length) {
+    // OSC strings are null terminated and padded to a multiple of 4
+    return (length + 4) & ~static_cast<size_t>(3);
+}
+
+static void osc_write32(char* destination, uint32_t value) {
+    destination[0] = value >> 24;
+    destination[1] = value >> 16;
+    destination[2] = value >> 8;
+    destination[3] = value;
+}
+
+static void osc_write64(char* destination, uint64_t value) {
+    osc_write32(destination, value >> 32);
+    osc_write32(destination + 4, static_cast<uint32_t>(value));
+}
+
+static uint64_t osc_timetag() {
+    // NTP time, or "immediately" (1) until the clock has been set
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    if (now.tv_sec < 1577836800) {
+        return 1;
+    }
+    uint64_t seconds = static_cast<uint64_t>(now.tv_sec) + 2208988800ULL;
+    uint64_t fraction = (static_cast<uint64_t>(now.tv_usec) << 32) / 1000000;
+    return (seconds << 32) | fraction;
+}
+
+// Packs a destination into one word: IPv4 address (network order) << 32,
+// port << 16, priority << 8 and 1 as the valid flag. 0 means not configured.
+static uint64_t osc_route(const char* ip, unsigned int port, unsigned int priority) {
+    struct in_addr address;
+    if (port == 0 || port > 65535 || inet_aton(ip, &address) == 0 || 
+        address.s_addr == htonl(INADDR_ANY)) {
+        return 0;
+    }
+    return (static_cast<uint64_t>(address.s_addr) << 32) | (port << 16) | (priority << 8) | 1;
+}
+
+// Reads an unsigned decimal from the front of text. Unlike strtoul alone, a
+// sign or leading space is rejected, as is anything above max.
+static bool osc_parse_number(std::string_view& text, unsigned long max, unsigned int& value) {
+    if (text.empty() || !isdigit(static_cast<unsigned char>(text.front()))) {
+        return false;
+    }
+    char digits[12];
+    size_t length = std::min(text.find_first_not_of("0123456789"), text.size());
+    if (length >= sizeof(digits)) {
+        return false;
+    }
+    memcpy(digits, text.data(), length);
+    digits[length] = '\0';
+    unsigned long number = strtoul(digits, nullptr, 10);
+    if (number > max) {
+        return false;
+    }
+    value = number;
+    text.remove_prefix(length);
+    return true;
+}
+
+// Reads the next "/number" field of a destination, if there is one
+static bool osc_parse_option(std::string_view& text, unsigned long max, unsigned int& value) {
+    if (text.empty()) {
+        return true;
+    }
+    if (text.front() != '/') {
+        return false;
+    }
+    text.remove_prefix(1);
+    return osc_parse_number(text, max, value);
+}
+
+// ip:port[/rate[/priority]], with the rate capped at one message per microsecond
+static uint64_t osc_parse_destination(std::string_view entry, unsigned int& rate) {
+    size_t colon = entry.find(':');
+    if (colon == std::string_view::npos || colon > 15 || 
+        entry.substr(0, colon).find_first_not_of("0123456789.") != std::string_view::npos) {
+        return 0;
+    }
+    std::string ip(entry.substr(0, colon));
+    entry.remove_prefix(colon + 1);
+    unsigned int port = 0, priority = 0;
+    rate = 0;
+    if (!osc_parse_number(entry, 65535, port) || 
+        !osc_parse_option(entry, 1000000, rate) ||
+        !osc_parse_option(entry, PUARA_OSC_PRIORITIES - 1, priority) || !entry.empty()) {
+        return 0;
+    }
+    return osc_route(ip.c_str(), port, priority);
+}
+
+void Puara::resolve_osc_destinations() {
+    // oscIP1 and oscIP2 are never rate limited or shed
+    uint64_t routes[PUARA_OSC_DESTINATIONS] = {
+        osc_route(oscIP1.c_str(), oscPORT1, PUARA_OSC_PRIORITIES - 1),
+        osc_route(oscIP2.c_str(), oscPORT2, PUARA_OSC_PRIORITIES - 1)
+    };
+    unsigned int rates[PUARA_OSC_DESTINATIONS] = {};
+    int count = 2;
+    std::string_view list(oscDestinations);
+    while (!list.empty()) {
+        size_t comma = list.find(',');
+        std::string_view item = list.substr(0, comma);
+        list.remove_prefix(comma == std::string_view::npos ? list.size() : comma + 1);
+        size_t first = item.find_first_not_of(' ');
+        if (first == std::string_view::npos) {
+            continue;
+        }
+        std::string entry(item.substr(first, item.find_last_not_of(' ') + 1 - first));
+        if (count == PUARA_OSC_DESTINATIONS) {
+            std::cout << "osc: Only " << PUARA_OSC_DESTINATIONS << " destinations supported, ignoring " 
+                      << entry << std::endl;
+            continue;
+        }
+        unsigned int rate;
+        if ((routes[count] = osc_parse_destination(entry, rate)) == 0) {
+            std::cout << "osc: Invalid destination " << entry << std::endl;
+            continue;
+        }
+        rates[count++] = rate;
+    }
+
+    int retired[PUARA_OSC_DESTINATIONS];
+    {
+        std::lock_guard<std::mutex> lock(osc_mutex);
+        for (int i = 0; i < PUARA_OSC_DESTINATIONS; i++) {
+            oscDestination& destination = osc_destinations[i];
+            uint64_t route = routes[i];
+            retired[i] = -1;
+            // a burst is PUARA_OSC_BURST_MS worth of messages, and at least one
+            uint32_t interval = rates[i] == 0 ? 0 : std::max(1000000u / rates[i], 1u);
+            uint32_t burst = std::max<uint64_t>(static_cast<uint64_t>(rates[i]) * PUARA_OSC_BURST_MS / 1000, 1);
+            if (route != destination.route.load() || interval != destination.interval_us.load()) {
+                // anything bundled for the old address still goes there
+                flush_osc_bundle(destination);
+                if (route != destination.route.load()) {
+                    // the next send opens a new socket, if the slot is still in use
+                    retired[i] = destination.socket.exchange(-1);
+                }
+                destination.interval_us.store(interval);
+                destination.burst_us.store((burst - 1) * interval);
+                destination.next_send_us.store(0);
+                destination.route.store(route, std::memory_order_release);
+            }
+        }
+    }
+
+    // A sender that loaded the old socket may still be in sendto; senders
+    // that started after the exchange see -1. The wait is outside osc_mutex
+    // as bundling senders take it while counted.
+    for (int i = 0; i < PUARA_OSC_DESTINATIONS; i++) {
+        if (retired[i] < 0) {
+            continue;
+        }
+        while (osc_destinations[i].senders.load() != 0) {
+            vTaskDelay(1);
+        }
+        close(retired[i]);
+    }
+}
+
+bool Puara::osc_paced(oscDestination& destination) {
+    uint32_t interval = destination.interval_us.load();
+    if (interval == 0) {
+        return true;
+    }
+    int64_t now = esp_timer_get_time();
+    int64_t next = destination.next_send_us.load();
+    while (true) {
+        if (next - now > static_cast<int64_t>(destination.burst_us.load())) {
+            return false;
+        }
+        if (destination.next_send_us.compare_exchange_weak(next, std::max(next, now) + interval)) {
+            return true;
+        }
+    }
+}
+
+void Puara::osc_congestion(bool failed) {
+    int64_t now = esp_timer_get_time();
+    int64_t changed = osc_shed_us.load();
+    int shed = osc_shed_priority.load();
+    if (failed) {
+        osc_failure_us.store(now);
+        if (shed < PUARA_OSC_PRIORITIES - 1 && now - changed >= PUARA_OSC_SHED_MS * 1000 &&
+            osc_shed_us.compare_exchange_strong(changed, now)) {
+            osc_shed_priority.store(shed + 1);
+            std::cout << "osc: Link congested, dropping destinations below priority " << shed + 1 << std::endl;
+        }
+    } else if (shed > 0 && now - osc_failure_us.load() >= PUARA_OSC_RECOVER_MS * 1000 && 
+               now - changed >= PUARA_OSC_RECOVER_MS * 1000 && osc_shed_us.compare_exchange_strong(changed, now)) {
+        osc_shed_priority.store(shed - 1);
+        std::cout << "osc: Restoring destinations of priority " << shed - 1 << std::endl;
+    }
+}
+
+bool Puara::send_osc(int destination, const void* data, size_t length) {
+    if (destination < 0 || destination >= PUARA_OSC_DESTINATIONS) {
+        return false;
+    }
+    oscDestination& target = osc_destinations[destination];
+    target.senders.fetch_add(1);
+    bool sent = send_osc_to(target, data, length);
+    target.senders.fetch_sub(1);
+    return sent;
+}
+
+bool Puara::send_osc_to(oscDestination& target, const void* data, size_t length) {
+    uint64_t route = target.route.load(std::memory_order_acquire);
+    if (route == 0) {
+        return false;
+    }
+    osc_messages++;
+    if (osc_shed_priority.load() > 0) {
+        osc_congestion(false);
+    }
+    int priority = (route >> 8) & 0xff;
+    if (priority < osc_shed_priority.load() || !osc_paced(target)) {
+        osc_dropped++;
+        return false;
+    }
+    if (target.socket.load(std::memory_order_acquire) < 0 && !open_osc_socket(target)) {
+        return false;
+    }
+    // #bundle, timetag, then a size-prefixed element per message
+    const size_t header = 16;
+    if (!osc_bundling.load()) {
+        return send_osc_packet(target, route, data, length);
+    }
+    std::lock_guard<std::mutex> lock(osc_mutex);
+    if (target.socket.load() < 0) {
+        // resolve_osc_destinations retired the socket since the check above
+        return false;
+    }
+    if (header + 4 + length > sizeof(target.bundle)) {
+        // too large to bundle: whatever is queued goes first to keep the order
+        flush_osc_bundle(target);
+        return send_osc_packet(target, route, data, length);
+    }
+    if (target.bundle_length + 4 + length > sizeof(target.bundle)) {
+        flush_osc_bundle(target);
+    }
+    if (target.bundle_length == 0) {
+        memcpy(target.bundle, "#bundle", 8);
+        osc_write64(target.bundle + 8, osc_timetag());
+        target.bundle_length = header;
+        target.bundle_deadline_us = esp_timer_get_time() + osc_bundle_deadline_ms * 1000LL;
+        if (osc_bundle_timer == nullptr) {
+            // zeroed first: the remaining fields differ between IDF releases
+            esp_timer_create_args_t timer_args = {};
+            timer_args.callback = &osc_bundle_deadline;
+            timer_args.dispatch_method = ESP_TIMER_TASK;
+            timer_args.name = "osc_bundle";
+            if (esp_timer_create(&timer_args, &osc_bundle_timer) != ESP_OK) {
+                osc_bundle_timer = nullptr;
+            }
+        }
+        if (osc_bundle_timer != nullptr) {
+            // fails harmlessly if the timer is already running for an earlier
+            // bundle, which re-arms it for this one when it fires
+            esp_timer_start_once(osc_bundle_timer, osc_bundle_deadline_ms * 1000ULL);
+        }
+    }
+    osc_write32(target.bundle + target.bundle_length, length);
+    memcpy(target.bundle + target.bundle_length + 4, data, length);
+    target.bundle_length += 4 + length;
+    return true;
+}
+
+// Sockets are opened on the first send rather than when the config is read:
+// read_config() runs before start_wifi() has brought lwIP up.
+bool Puara::open_osc_socket(oscDestination& destination) {
+    std::lock_guard<std::mutex> lock(osc_mutex);
+    if (destination.socket.load() >= 0) {
+        return true;
+    }
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+    if (fd < 0) {
+        std::cout << "osc: Failed to create socket (errno " << errno << ")" << std::endl;
+        return false;
+    }
+    destination.socket.store(fd, std::memory_order_release);
+    return true;
+}
+
+bool Puara::send_osc_packet(const oscDestination& destination, uint64_t route, const void* data, size_t length) {
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = route >> 32;
+    address.sin_port = htons((route >> 16) & 0xffff);
+    if (sendto(destination.socket.load(), data, length, 0, (const struct sockaddr*) &address, 
+               sizeof(address)) != (ssize_t) length) {
+        // lwIP reports a full transmit queue as ENOMEM
+        if (errno == ENOMEM || errno == ENOBUFS || errno == EAGAIN) {
+            osc_congestion(true);
+        }
+        return false;
+    }
+    osc_packets++;
+    osc_bytes += length;
+    return true;
+}
+
+bool Puara::flush_osc_bundle(oscDestination& destination) {
+    if (destination.bundle_length == 0) {
+        return true;
+    }
+    size_t length = destination.bundle_length;
+    destination.bundle_length = 0;
+    uint64_t route = destination.route.load();
+    if (route == 0) {
+        return false;
+    }
+    return send_osc_packet(destination, route, destination.bundle, length);
+}
+
+void Puara::osc_bundle_deadline(void *arg) {
+    std::lock_guard<std::mutex> lock(osc_mutex);
+    int64_t now = esp_timer_get_time();
+    int64_t next = INT64_MAX;
+    for (oscDestination& destination : osc_destinations) {
+        if (destination.bundle_length == 0) {
+            continue;
+        }
+        if (destination.bundle_deadline_us <= now) {
+            flush_osc_bundle(destination);
+        } else {
+            next = std::min(next, destination.bundle_deadline_us);
+        }
+    }
+    if (next != INT64_MAX) {
+        esp_timer_start_once(osc_bundle_timer, next - now);
+    }
+}
+
+void Puara::flush_osc() {
+    std::lock_guard<std::mutex> lock(osc_mutex);
+    if (osc_bundle_timer != nullptr) {
+        esp_timer_stop(osc_bundle_timer);
+    }
+    for (oscDestination& destination : osc_destinations) {
+        flush_osc_bundle(destination);
+    }
+}
+
+void Puara::set_osc_bundling(bool enabled, unsigned int deadline_ms) {
+    {
+        std::lock_guard<std::mutex> lock(osc_mutex);
+        osc_bundling = enabled;
+        osc_bundle_deadline_ms = std::max(deadline_ms, 1u);
+    }
+    if (!enabled) {
+        flush_osc();
+    }
+}
+
+Puara::oscStatistics Puara::get_osc_statistics() {
+    return {osc_messages.load(), osc_packets.load(), osc_bytes.load(), osc_dropped.load()};
+}
+
+bool PuaraOSC::begin(const char* address, const char* type_tags) {
+    length = 0;
+    count = 0;
+    size_t address_length = strlen(address);
+    size_t tags_length = strlen(type_tags);
+    if (address[0] != '/' || tags_length > PUARA_OSC_MAX_ARGS) {
+        std::cout << "osc: Invalid message " << address << std::endl;
+        return false;
+    }
+    size_t size = osc_padded(address_length) + osc_padded(tags_length + 1);
+    for (size_t i = 0; i < tags_length; i++) {
+        switch (type_tags[i]) {
+            case 'i': case 'f':
+                offsets[i] = size;
+                size += 4;
+                break;
+            case 'h': case 'd':
+                offsets[i] = size;
+                size += 8;
+                break;
+            default:
+                std::cout << "osc: Unsupported type tag '" << type_tags[i] << "' in " << address << std::endl;
+                return false;
+        }
+        types[i] = type_tags[i];
+    }
+    if (size > sizeof(packet)) {
+        std::cout << "osc: Message " << address << " longer than " << PUARA_OSC_MESSAGE_SIZE << " bytes" << std::endl;
+        return false;
+    }
+    memset(packet, 0, size);
+    memcpy(packet, address, address_length);
+    char* tags = packet + osc_padded(address_length);
+    tags[0] = ',';
+    memcpy(tags + 1, type_tags, tags_length);
+    length = size;
+    count = tags_length;
+    return true;
+}
+
+void PuaraOSC::store_integer(int index, int64_t value) {
+    if (index < 0 || index >= count) {
+        return;
+    }
+    switch (types[index]) {
+        case 'i':
+            osc_write32(packet + offsets[index], static_cast<uint32_t>(static_cast<int32_t>(value)));
+            break;
+        case 'h':
+            osc_write64(packet + offsets[index], static_cast<uint64_t>(value));
+            break;
+        default:
+            store_float(index, static_cast<double>(value));
+            break;
+    }
+}
+
+void PuaraOSC::store_float(int index, double value) {
+    if (index < 0 || index >= count) {
+        return;
+    }
+    switch (types[index]) {
+        case 'f': {
+            float single = value;
+            uint32_t bits;
+            memcpy(&bits, &single, sizeof(bits));
+            osc_write32(packet + offsets[index], bits);
+            break;
+        }
+        case 'd': {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            osc_write64(packet + offsets[index], bits);
+            break;
+        }
+        default:
+            store_integer(index, static_cast<int64_t>(value));
+            break;
     }
+}
 
-    std::cout << "webserver: Error starting server!" << std::endl;
-    return NULL;
+void PuaraOSC::set(int index, int32_t value) {
+    store_integer(index, value);
 }
 
-void Puara::stop_webserver(void) {
-    // Stop the httpd server
-    httpd_stop(webserver);
+void PuaraOSC::set(int index, int64_t value) {
+    store_integer(index, value);
 }
 
-std::string Puara::convertToString(char* a) {
-    std::string s(a);
-    return s;
+void PuaraOSC::set(int index, float value) {
+    store_float(index, value);
 }
 
-void Puara::send_serial_data(std::string data) {
-    std::cout << Puara::data_start << data << Puara::data_end << std::endl;
+void PuaraOSC::set(int index, double value) {
+    store_float(index, value);
 }
 
-void Puara::interpret_serial(void *pvParameters) {
-    while (1) {
-        vTaskDelay(1000 / portTICK_RATE_MS);
-        if (serial_data_str.empty()) {
-            continue;
-        }
-        if ( serial_data_str.compare("reset") == 0 ||
-             serial_data_str.compare("reboot") == 0 ) {
-            std::cout <<  "\nRebooting...\n" << std::endl;
-            xTaskCreate(&Puara::reboot_with_delay, "reboot_with_delay", 1024, NULL, 10, NULL);
-        } else if (serial_data_str.compare("ping") == 0) {
-            std::cout << "pong\n";
-        } else if (serial_data_str.compare("whatareyou") == 0) {
-            Puara::send_serial_data(Puara::dmiName);
-        } else if (serial_data_str.rfind("sendconfig", 0) == 0) {
-            serial_data_str_buffer = serial_data_str.substr(serial_data_str.find(" ")+1);
-            Puara::read_config_json_internal(serial_data_str_buffer);
-        } else if (serial_data_str.rfind("writeconfig") == 0) {
-            Puara::write_config_json();
-        } else if (serial_data_str.compare("readconfig") == 0) {
-            Puara::mount_spiffs();
-            FILE* f = fopen("/spiffs/config.json", "r");
-            if (f == NULL) {
-                std::cout << "json: Failed to open file" << std::endl;
-                return;
-            }
-            std::ifstream in("/spiffs/config.json");
-            std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
-            Puara::send_serial_data(contents);
-            fclose(f);
-            Puara::unmount_spiffs();
-        } else if (serial_data_str.rfind("sendsettings", 0) == 0) {
-            serial_data_str_buffer = serial_data_str.substr(serial_data_str.find(" ")+1);
-            Puara::read_settings_json_internal(serial_data_str_buffer, true);
-        } else if (serial_data_str.rfind("writesettings") == 0) {
-            Puara::write_settings_json();
-        } else if (serial_data_str.compare("readsettings") == 0) {
-            Puara::mount_spiffs();
-            FILE* f = fopen("/spiffs/settings.json", "r");
-            if (f == NULL) {
-                std::cout << "json: Failed to open file" << std::endl;
-                return;
-            }
-            std::ifstream in("/spiffs/settings.json");
-            std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
-            Puara::send_serial_data(contents);
-            fclose(f);
-            Puara::unmount_spiffs();
-        } else {
-            std::cout << "\nI don´t recognize the command \"" << serial_data_str << "\""<< std::endl;
-        }
-        serial_data_str.clear();
+bool PuaraOSC::send(int destination) {
+    if (length == 0) {
+        return false;
     }
+    return Puara::send_osc(destination, packet, length);
 }
 
-    void Puara::uart_monitor(void *pvParameters) {
-        const int uart_num0 = 0; //UART port 0
-        uart_config_t uart_config0 = {
-            .baud_rate = 115200,
-            .data_bits = UART_DATA_8_BITS,
-            .parity = UART_PARITY_DISABLE,
-            .stop_bits = UART_STOP_BITS_1,
-            .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,    //UART_HW_FLOWCTRL_CTS_RTS,
-            .rx_flow_ctrl_thresh = 122,
-            .source_clk = UART_SCLK_APB,
-        };
-
-        //Configure UART1 parameters
-        uart_param_config(uart_num0, &uart_config0);
-
-        uart_set_pin(uart_num0, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
-        
-        //Install UART driver (we don't need an event queue here)
-        //In this example we don't even use a buffer for sending data.
-        uart_driver_install(uart_num0, UART_FIFO_LEN + 1, 0, 0, NULL, 0);
-
-        while(1) {
-            //Read data from UART
-            serial_data_length = uart_read_bytes(uart_num0, serial_data, PUARA_SERIAL_BUFSIZE, 500 / portTICK_RATE_MS);
-            if (serial_data_length > 0) {
-                serial_data_str = convertToString(serial_data);
-                memset(serial_data, 0, sizeof serial_data);
-                uart_flush(uart_num0);
-            }
-        }
+bool PuaraOSC::send() {
+    bool sent = false;
+    for (int i = 0; i < PUARA_OSC_DESTINATIONS; i++) {
+        sent = send(i) || sent;
     }
+    return sent;
+}
 
-    void Puara::jtag_monitor(void *pvParameters) {
-        #if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
-        // Setup jtag module for USB Serial reads
-        usb_serial_jtag_driver_config_t jtag_config {
-            .tx_buffer_size = 256,
-            .rx_buffer_size = 256,
-        };
-
-        // Install jtag module
-        usb_serial_jtag_driver_install(&jtag_config);
-
-        while(1) {
-            // serial_data_length = USBSerial.read();
-            // Only read if connected to PC
-            serial_data_length = usb_serial_jtag_read_bytes(serial_data, PUARA_SERIAL_BUFSIZE, 500 / portTICK_RATE_MS);
-            if (serial_data_length > 0) {
-                serial_data_str = convertToString(serial_data);
-                // remove new line character at end
-                if (serial_data_str[serial_data_str.size() - 1] == '\n')
-                    serial_data_str.erase(serial_data_str.size() - 1);
-                if (serial_data_str[serial_data_str.size() - 1] == '\r')
-                    serial_data_str.erase(serial_data_str.size() - 1); 
-                memset(serial_data, 0, sizeof serial_data);
-            }
-        }
-        #endif
-    }
+static uint32_t osc_read32(const char* source) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(source);
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+}
 
-    void Puara::usb_monitor(void *pvParameters) {
-        #if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
-        // // Setup usb module for USB reads
-        // const char *product_name = dmiName.c_str();
-        // const char *manufacturer_name = author.c_str();
+static uint64_t osc_read64(const char* source) {
+    return (static_cast<uint64_t>(osc_read32(source)) << 32) | osc_read32(source + 4);
+}
 
-        // tinyusb_device_config_t usb_config = {                                    
-        //     .vid = USB_ESPRESSIF_VID,                                       
-        //     .pid = 0x0002,                                                  
-        //     .product_name = product_name,                 
-        //     .manufacturer_name = manufacturer_name,       
-        //     .serial_number = product_name,                 
-        //     .fw_version = version,                        
-        //     .usb_version = 0x0200,                                          
-        //     .usb_class = TUSB_CLASS_MISC,                                   
-        //     .usb_subclass = MISC_SUBCLASS_COMMON,                           
-        //     .usb_protocol = MISC_PROTOCOL_IAD,                              
-        //     .usb_attributes = TUSB_DESC_CONFIG_ATT_SELF_POWERED,            
-        //     .usb_power_ma = 500,                                            
-        //     .webusb_enabled = false,                                        
-        //     .webusb_url = "espressif.github.io/arduino-esp32/webusb.html"   
-        // };
+bool PuaraOSCMessage::is_number(size_t index) const {
+    return index < types.size() && strchr("ifhdTF", types[index]) != nullptr;
+}
 
-        // // Setup USB interface
-        // tinyusb_init(&usb_config);
-        // TODO: Read from USB interface
-        std::cout << "USB OTG monitor not supported, use the USB Serial JTAG or UART interface" << std::endl;
-        #endif
+double PuaraOSCMessage::number(size_t index) const {
+    if (index >= types.size()) {
+        return 0;
     }
-
-    bool Puara::start_serial_listening() {
-        //std::cout << "starting serial monitor \n";
-        if (module_monitor == UART_MONITOR) {
-            xTaskCreate(uart_monitor, "serial_monitor", 2048, NULL, 10, NULL);
-            xTaskCreate(interpret_serial, "interpret_serial", 4096, NULL, 10, NULL);
-        } else if (module_monitor == JTAG_MONITOR) {
-            xTaskCreate(jtag_monitor, "serial_monitor", 2048, NULL, 10, NULL);
-            xTaskCreate(interpret_serial, "interpret_serial", 4096, NULL, 10, NULL);
-        } else if (module_monitor == USB_MONITOR) {
-            xTaskCreate(usb_monitor, "serial_monitor", 2048, NULL, 10, NULL);
-            xTaskCreate(interpret_serial, "interpret_serial", 4096, NULL, 10, NULL);
-        } else {
-            std::cout << "Invalid Monitor Type" << std::endl;
+    switch (types[index]) {
+        case 'i':
+            return static_cast<int32_t>(osc_read32(arguments[index]));
+        case 'h':
+            return static_cast<double>(static_cast<int64_t>(osc_read64(arguments[index])));
+        case 'f': {
+            uint32_t bits = osc_read32(arguments[index]);
+            float value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
         }
-        return 1;
+        case 'd': {
+            uint64_t bits = osc_read64(arguments[index]);
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        case 'T':
+            return 1;
+        default:
+            return 0;
     }
+}
 
-void Puara::reboot_with_delay(void *pvParameter) {
-    vTaskDelay(reboot_delay / portTICK_RATE_MS);
-    esp_restart();
+bool PuaraOSCMessage::is_text(size_t index) const {
+    return index < types.size() && (types[index] == 's' || types[index] == 'S');
 }
 
-void Puara::start_mdns_service(const char * device_name, const char * instance_name) {
-    //initialize mDNS service
-    esp_err_t err = mdns_init();
-    if (err) {
-        std::cout << "MDNS Init failed: " << err << std::endl;
-        return;
+std::string_view PuaraOSCMessage::text(size_t index) const {
+    if (!is_text(index)) {
+        return std::string_view();
     }
-    //set hostname
-    ESP_ERROR_CHECK(mdns_hostname_set(device_name));
-    //set default instance
-    ESP_ERROR_CHECK(mdns_instance_name_set(instance_name));
-    std::cout << "MDNS Init completed. Device name: " << device_name << "\n" << std::endl;
+    return std::string_view(arguments[index]);
 }
 
-void Puara::start_mdns_service(std::string device_name, std::string instance_name) {
-    //initialize mDNS service
-    esp_err_t err = mdns_init();
-    if (err) {
-        std::cout << "MDNS Init failed: " << err << std::endl;
-        return;
+// OSC address pattern matching for one segment: * matches any run of
+// characters, ? any one character, [a-z] or [!a-z] a set and {foo,bar}
+// any of the listed strings. Only the last * is kept for backtracking, so a
+// pattern full of stars costs pattern length times name length; each {}
+// recurses for the rest of the pattern, at most PUARA_OSC_MAX_BRACES deep.
+static bool osc_pattern_match(std::string_view pattern, std::string_view name, int braces = 0) {
+    size_t p = 0;
+    size_t n = 0;
+    size_t star_pattern = std::string_view::npos;
+    size_t star_name = 0;
+    while (p < pattern.size() || n < name.size()) {
+        if (p < pattern.size()) {
+            char c = pattern[p];
+            if (c == '*') {
+                while (p < pattern.size() && pattern[p] == '*') {
+                    p++;
+                }
+                if (p == pattern.size()) {
+                    return true;
+                }
+                star_pattern = p;
+                star_name = n;
+                continue;
+            }
+            if (c == '{') {
+                size_t close = pattern.find('}', p);
+                if (close == std::string_view::npos || braces == PUARA_OSC_MAX_BRACES) {
+                    return false;
+                }
+                std::string_view options = pattern.substr(p + 1, close - p - 1);
+                std::string_view rest = pattern.substr(close + 1);
+                while (true) {
+                    size_t comma = options.find(',');
+                    std::string_view option = options.substr(0, comma);
+                    if (name.substr(n, option.size()) == option &&
+                        osc_pattern_match(rest, name.substr(n + option.size()), braces + 1)) {
+                        return true;
+                    }
+                    if (comma == std::string_view::npos) {
+                        break;
+                    }
+                    options.remove_prefix(comma + 1);
+                }
+            } else if (c == '[') {
+                size_t close = pattern.find(']', p + 2);
+                if (close == std::string_view::npos) {
+                    return false;
+                }
+                if (n < name.size()) {
+                    std::string_view set = pattern.substr(p + 1, close - p - 1);
+                    bool negate = set[0] == '!';
+                    if (negate) {
+                        set.remove_prefix(1);
+                    }
+                    bool found = false;
+                    for (size_t i = 0; i < set.size(); i++) {
+                        if (i + 2 < set.size() && set[i + 1] == '-') {
+                            found |= name[n] >= set[i] && name[n] <= set[i + 2];
+                            i += 2;
+                        } else {
+                            found |= name[n] == set[i];
+                        }
+                    }
+                    if (found != negate) {
+                        p = close + 1;
+                        n++;
+                        continue;
+                    }
+                }
+            } else if (n < name.size() && (c == '?' || c == name[n])) {
+                p++;
+                n++;
+                continue;
+            }
+        }
+        // Mismatch: let the last * take one more character and retry
+        if (star_pattern == std::string_view::npos || star_name == name.size()) {
+            return false;
+        }
+        p = star_pattern;
+        n = ++star_name;
     }
-    //set hostname
-    ESP_ERROR_CHECK(mdns_hostname_set(device_name.c_str()));
-    //set default instance
-    ESP_ERROR_CHECK(mdns_instance_name_set(instance_name.c_str()));
-    std::cout << "MDNS Init completed. Device name: " << device_name << "\n" << std::endl;
+    return true;
 }
 
-void Puara::wifi_scan(void) {
-
-    uint16_t number = wifiScanSize;
-    wifi_ap_record_t ap_info[wifiScanSize];
-    uint16_t ap_count = 0;
-    memset(ap_info, 0, sizeof(ap_info));
-
-    esp_wifi_scan_start(NULL, true);
-    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&number, ap_info));
-    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_num(&ap_count));
-    std::cout << "wifi_scan: Total APs scanned = " << ap_count << std::endl;
-    wifiAvailableSsid.clear();
-    for (int i = 0; (i < wifiScanSize) && (i < ap_count); i++) {
-        wifiAvailableSsid.append("<strong>SSID: </strong>");
-        wifiAvailableSsid.append(reinterpret_cast<const char*>(ap_info[i].ssid));
-        wifiAvailableSsid.append("<br>      (RSSI: ");
-        wifiAvailableSsid.append(std::to_string(ap_info[i].rssi));
-        wifiAvailableSsid.append(", Channel: ");
-        wifiAvailableSsid.append(std::to_string(ap_info[i].primary));
-        wifiAvailableSsid.append(")<br>");
+static int split_osc_address(std::string_view address, std::string_view* segments) {
+    if (address.empty() || address[0] != '/') {
+        return -1;
+    }
+    int count = 0;
+    address.remove_prefix(1);
+    while (!address.empty()) {
+        if (count == PUARA_OSC_MAX_SEGMENTS) {
+            return -1;
+        }
+        size_t slash = address.find('/');
+        segments[count++] = address.substr(0, slash);
+        if (slash == std::string_view::npos) {
+            break;
+        }
+        address.remove_prefix(slash + 1);
     }
+    return count;
 }
 
-std::string Puara::urlDecode(std::string text) {
-      
-    std::string escaped;
-    for (auto i = text.begin(), nd = text.end(); i < nd; ++i){
-      auto c = ( *i );
-       switch(c) {
-        case '%':
-          if (i[1] && i[2]) {
-              char hs[]{ i[1], i[2] };
-              escaped += static_cast<char>(strtol(hs, nullptr, 16));
-              i += 2;
-          }
-          break;
-        case '+':
-          escaped += ' ';
-          break;
-        default:
-          escaped += c;
-      }
+bool Puara::add_osc_handler(std::string_view address, oscHandler handler, void* context) {
+    std::string_view segments[PUARA_OSC_MAX_SEGMENTS];
+    int count = split_osc_address(address, segments);
+    if (count < 0 || address.find_first_of("*?[]{},# ") != std::string_view::npos) {
+        std::cout << "osc: Invalid address " << address << std::endl;
+        return false;
+    }
+    int node = 0;
+    for (int i = 0; i < count; i++) {
+        std::vector<int>& children = osc_nodes[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), segments[i], 
+            [](int child, std::string_view segment) { return osc_nodes[child].segment < segment; });
+        if (it != children.end() && osc_nodes[*it].segment == segments[i]) {
+            node = *it;
+            continue;
+        }
+        int child = osc_nodes.size();
+        children.insert(it, child);
+        osc_nodes.push_back(oscNode{std::string(segments[i]), {}, {}});
+        node = child;
     }
-    return escaped;
+    osc_nodes[node].handlers.push_back({handler, context});
+    return true;
 }
 
-bool Puara::get_StaIsConnected() {
-    return StaIsConnected;
+bool Puara::register_osc_handler(std::string_view address,
+                                 void (*handler)(const PuaraOSCMessage& message, void* context),
+                                 void* context) {
+    std::lock_guard<std::mutex> lock(osc_nodes_mutex);
+    return add_osc_handler(address, handler, context);
 }
 
-double Puara::getVarNumber(std::string varName) {
-    return variables.at(variables_fields.at(varName)).numberValue;
-}
-        
-std::string Puara::getVarText(std::string varName) {
-    return variables.at(variables_fields.at(varName)).textValue;
+void Puara::register_osc_settings() {
+    settingsReadGuard guard;
+    if (guard->layout == osc_settings_layout) {
+        return;
+    }
+    osc_settings_layout = guard->layout;
+    for (oscNode& node : osc_nodes) {
+        node.handlers.erase(std::remove_if(node.handlers.begin(), node.handlers.end(), 
+            [](const std::pair<oscHandler, void*>& entry) { return entry.first == osc_setting_handler; }), 
+            node.handlers.end());
+    }
+    osc_setting_names.clear();
+    const settingsStore& variables = guard->variables;
+    for (size_t i = 0; i < variables.size(); i++) {
+        osc_setting_names.emplace_back(new std::string(variables.name(i)));
+        add_osc_handler("/settings/" + *osc_setting_names.back(), osc_setting_handler, 
+                        osc_setting_names.back().get());
+    }
 }
 
-std::string Puara::getIP1() {
-    return oscIP1;
+void Puara::dispatch_osc_node(int node, const std::string_view* segments, int count,
+                              const PuaraOSCMessage& message) {
+    if (count == 0) {
+        for (const auto& entry : osc_nodes[node].handlers) {
+            entry.first(message, entry.second);
+        }
+        return;
+    }
+    const std::vector<int>& children = osc_nodes[node].children;
+    std::string_view segment = segments[0];
+    if (segment.find_first_of("*?[{") == std::string_view::npos) {
+        auto it = std::lower_bound(children.begin(), children.end(), segment, 
+            [](int child, std::string_view segment) { return osc_nodes[child].segment < segment; });
+        if (it != children.end() && osc_nodes[*it].segment == segment) {
+            dispatch_osc_node(*it, segments + 1, count - 1, message);
+        }
+        return;
+    }
+    for (int child : children) {
+        if (osc_pattern_match(segment, osc_nodes[child].segment)) {
+            dispatch_osc_node(child, segments + 1, count - 1, message);
+        }
+    }
 }
 
-std::string Puara::getIP2() {
-    return oscIP2;
+// Length of the padded OSC string at data, or 0 if it is not terminated
+static size_t osc_string_size(const char* data, size_t length) {
+    const char* end = static_cast<const char*>(memchr(data, '\0', length));
+    if (end == nullptr) {
+        return 0;
+    }
+    return std::min(osc_padded(end - data), length);
 }
 
-int unsigned Puara::getPORT1() {
-    return oscPORT1;
-}
+bool Puara::dispatch_osc_packet(char* data, size_t length, int depth) {
+    if (length >= 16 && memcmp(data, "#bundle", 8) == 0) {
+        // elements are dispatched right away, whatever the timetag says
+        if (depth > 4) {
+            return false;
+        }
+        bool valid = true;
+        size_t offset = 16;
+        while (offset + 4 <= length) {
+            size_t size = osc_read32(data + offset);
+            offset += 4;
+            if (size > length - offset || size % 4 != 0) {
+                valid = false;
+                break;
+            }
+            dispatch_osc_packet(data + offset, size, depth + 1);
+            offset += size;
+        }
+        if (depth == 0) {
+            // the elements read before a malformed one still take effect
+            publish_osc_settings();
+        }
+        return valid;
+    }
 
-int unsigned Puara::getPORT2() {
-    return oscPORT2;
-}
+    PuaraOSCMessage message;
+    size_t offset = osc_string_size(data, length);
+    if (offset == 0 || data[0] != '/') {
+        return false;
+    }
+    message.address = std::string_view(data);
+    if (offset < length && data[offset] == ',') {
+        size_t types_size = osc_string_size(data + offset, length - offset);
+        if (types_size == 0) {
+            return false;
+        }
+        message.types = std::string_view(data + offset + 1);
+        offset += types_size;
+    }
+    if (message.types.size() > PUARA_OSC_MAX_ARGS) {
+        return false;
+    }
+    for (size_t i = 0; i < message.types.size(); i++) {
+        size_t size;
+        switch (message.types[i]) {
+            case 'i': case 'f': case 'c': case 'r': case 'm':
+                size = 4;
+                break;
+            case 'h': case 'd': case 't':
+                size = 8;
+                break;
+            case 's': case 'S':
+                size = offset < length ? osc_string_size(data + offset, length - offset) : 0;
+                break;
+            case 'b':
+                size = offset + 4 <= length ? 4 + ((osc_read32(data + offset) + 3) & ~3u) : 0;
+                break;
+            case 'T': case 'F': case 'N': case 'I':
+                size = 0;
+                break;
+            default:
+                return false;
+        }
+        if (size > length - offset || (size == 0 && strchr("TFNI", message.types[i]) == nullptr)) {
+            return false;
+        }
+        message.arguments[i] = data + offset;
+        offset += size;
+    }
 
-std::string Puara::getPORT1Str() {
-    return std::to_string(oscPORT1);
+    std::string_view segments[PUARA_OSC_MAX_SEGMENTS];
+    int count = split_osc_address(message.address, segments);
+    if (count < 0) {
+        return false;
+    }
+    dispatch_osc_node(0, segments, count, message);
+    if (depth == 0) {
+        publish_osc_settings();
+    }
+    return true;
 }
 
-std::string Puara::getPORT2Str() {
-    return std::to_string(oscPORT2);
+void Puara::osc_setting_handler(const PuaraOSCMessage& message, void* context) {
+    const std::string* name = static_cast<const std::string*>(context);
+    if (message.is_number(0)) {
+        osc_setting_writes.push_back({name, true, message.number(0), std::string_view()});
+    } else if (message.is_text(0)) {
+        osc_setting_writes.push_back({name, false, 0, message.text(0)});
+    }
 }
 
-int unsigned Puara::getLocalPORT() {
-    return localPORT;
+void Puara::publish_osc_settings() {
+    if (osc_setting_writes.empty()) {
+        return;
+    }
+    // Writers are serialised, so the current snapshot stays valid under the
+    // lock. It is copied once, at the first write that changes a value.
+    std::unique_lock<std::mutex> lock(settings_write_mutex);
+    const settingsStore& current = settings_current.load()->variables;
+    std::unique_ptr<settingsSnapshot> next;
+    // Newest first: only the last write of the right type to a setting counts
+    for (auto write = osc_setting_writes.rbegin(); write != osc_setting_writes.rend(); ++write) {
+        if (write->name == nullptr) {
+            continue;
+        }
+        int index = current.find(*write->name);
+        if (index < 0 || (current.types[index] == SETTING_NUMBER) != write->is_number) {
+            continue;
+        }
+        for (auto older = write + 1; older != osc_setting_writes.rend(); ++older) {
+            if (older->name == write->name) {
+                older->name = nullptr;
+            }
+        }
+        if (write->is_number ? current.numbers[index] == write->number : current.text(index) == write->text) {
+            continue;
+        }
+        if (!next) {
+            next = copy_settings();
+        }
+        if (write->is_number) {
+            next->variables.numbers[index] = write->number;
+        } else {
+            next->variables.set_text(index, write->text);
+        }
+    }
+    osc_setting_writes.clear();
+    if (next) {
+        publish_settings(std::move(next), false);
+        lock.unlock();
+        config_generation++;
+    }
 }
 
-std::string Puara::getLocalPORTStr() {
-    return std::to_string(localPORT);
+void Puara::osc_save_handler(const PuaraOSCMessage& message, void* context) {
+    // Only a bare /settings/save persists, so a pattern such as
+    // /settings/* carrying a value does not write flash as a side effect
+    if (!message.types.empty()) {
+        return;
+    }
+    // values set earlier in the same bundle are saved too
+    publish_osc_settings();
+    save_settings();
 }
 
-bool Puara::IP1_ready() {
-    if ((oscIP1 == "0.0.0.0") || (oscIP1 == "")) {
-        return false;
-    } else {
-        return true;
+void Puara::start_osc_receiver() {
+    if (localPORT == 0 || localPORT > 65535) {
+        std::cout << "osc: localPORT not set, not listening for OSC" << std::endl;
+        return;
+    }
+    osc_receive_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+    if (osc_receive_socket < 0) {
+        std::cout << "osc: Failed to create socket (errno " << errno << ")" << std::endl;
+        return;
     }
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(localPORT);
+    if (bind(osc_receive_socket, (struct sockaddr*) &address, sizeof(address)) < 0) {
+        std::cout << "osc: Failed to bind port " << localPORT << " (errno " << errno << ")" << std::endl;
+        close(osc_receive_socket);
+        osc_receive_socket = -1;
+        return;
+    }
+    register_osc_handler("/settings/save", osc_save_handler);
+    xTaskCreate(receive_osc, "osc_receiver", 4096, NULL, tskIDLE_PRIORITY+3, &osc_receiver);
+    std::cout << "osc: Listening on port " << localPORT << std::endl;
 }
 
-bool Puara::IP2_ready() {
-    if ((oscIP2 == "0.0.0.0") || (oscIP2 == "")) {
-        return false;
-    } else {
-        return true;
+void Puara::receive_osc(void *arg) {
+    static char packet[PUARA_OSC_RECEIVE_SIZE];
+    while (true) {
+        int length = recv(osc_receive_socket, packet, sizeof(packet), 0);
+        if (length <= 0) {
+            vTaskDelay(10 / portTICK_RATE_MS);
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(osc_nodes_mutex);
+        register_osc_settings();
+        dispatch_osc_packet(packet, length, 0);
     }
 }
@@ -9,9 +9,62 @@
 #define PUARA_H
 
 #define PUARA_SERIAL_BUFSIZE 1024
+#define PUARA_SERIAL_RING_SIZE 4096
+#define PUARA_SERIAL_IDLE_MS 50
+#define PUARA_SERIAL_USER_COMMANDS 16
+#define PUARA_SERIAL_TRANSFER_TIMEOUT_MS 2000
+#define PUARA_SETTINGS_SUBSCRIBERS 8
+#define PUARA_JSON_MAX_DEPTH 8
+// Longest JSON string or form field, the most a record field holds. Longer
+// ones are reported by name and skipped, the rest of the document is read.
+#define PUARA_JSON_TOKEN_SIZE 65535
+#define PUARA_FORM_FIELD_SIZE 65535
+#define PUARA_API_MAX_BODY 8192
+#define PUARA_RECORD_VERSION 1
+#define PUARA_SAVE_DELAY_MS 1000
+#define PUARA_SAVE_MAX_DELAY_MS 5000
+// Define PUARA_CONFIG_NVS to keep the config in NVS (one key per field)
+// instead of the SPIFFS record; an existing record or config.json is
+// migrated on first boot
+#define PUARA_NVS_NAMESPACE "puara"
+// Define PUARA_BOOT_PROFILE to time the phases of Puara::start(). Without it
+// PUARA_BOOT_PHASE() expands to nothing.
+#define PUARA_BOOT_PHASES 16
+#ifdef PUARA_BOOT_PROFILE
+#define PUARA_BOOT_PHASE(name) Puara::boot_phase(name)
+#else
+#define PUARA_BOOT_PHASE(name) do {} while (0)
+#endif
+#define PUARA_OSC_MESSAGE_SIZE 256
+#define PUARA_OSC_MAX_ARGS 16
+// Bundles are kept within one Ethernet/Wi-Fi MTU (1500 - IP and UDP headers)
+#define PUARA_OSC_BUNDLE_SIZE 1472
+#define PUARA_OSC_BUNDLE_DEADLINE_MS 5
+#define PUARA_OSC_RECEIVE_SIZE 1536
+// oscIP1, oscIP2 and up to 6 entries from oscDestinations
+#define PUARA_OSC_DESTINATIONS 8
+// Priorities run from 0 (shed first) to 7 (never shed)
+#define PUARA_OSC_PRIORITIES 8
+// A rate-limited destination may send this much of its rate in one burst
+#define PUARA_OSC_BURST_MS 100
+// When sends fail for lack of buffers, one more priority level is shed at
+// most every SHED_MS, and one is restored after RECOVER_MS without failures
+#define PUARA_OSC_SHED_MS 100
+#define PUARA_OSC_RECOVER_MS 1000
+#define PUARA_OSC_MAX_SEGMENTS 16
+// {} groups in one address pattern segment
+#define PUARA_OSC_MAX_BRACES 4
+#define PUARA_ASSET_CACHE_SIZE 32768
+#define PUARA_HTTP_CHUNK_SIZE 1024
+#define PUARA_HTTP_MAX_AGE 86400
+#define PUARA_STRINGIFY_VALUE(x) #x
+#define PUARA_STRINGIFY(x) PUARA_STRINGIFY_VALUE(x)
 
 #include <stdio.h>
+#include <stdarg.h>
+#include <unistd.h>
 #include <string>
+#include <string_view>
 #include <cstring>
 #include <ostream>
 #include <fstream>
@@ -20,6 +73,11 @@
 #include <iomanip>
 #include <vector>
 #include <unordered_map>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <type_traits>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/event_groups.h>
@@ -27,6 +85,8 @@
 #include <esp_spi_flash.h>
 #include <esp_wifi.h>
 #include <nvs_flash.h>
+#include <nvs.h>
+#include <esp_timer.h>
 #include <sys/param.h>
 #include <esp_err.h>
 #include <esp_spiffs.h>
@@ -34,6 +94,7 @@
 #include <esp_http_server.h>
 #include <driver/uart.h>
 #include <mdns.h>
+#include <lwip/sockets.h>
 #if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
 #include <driver/usb_serial_jtag.h> // jtag module
 #endif
@@ -45,28 +106,108 @@
 #include <esp_log.h>
 #include <sys/unistd.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 #include <lwip/err.h>
 #include <lwip/sys.h>
 #include <esp_event.h>
 #include <soc/uart_struct.h>
 #include "esp_console.h"
 
+struct puaraAsset; // web pages embedded at build time, see tools/embed_assets.py
+template <typename T> class SettingHandle;
+struct PuaraOSCMessage;
 
 class Puara {
+    // Host tests and benchmarks reach the internals, see tools/host
+    friend class PuaraTest;
     
     private:
         static unsigned int version;
         static std::string dmiName;
 
-        struct settingsVariables {
-            std::string name;
-            std::string type;
-            std::string textValue;
-            double numberValue;
+        enum settingType : uint8_t {
+            SETTING_TEXT,
+            SETTING_NUMBER
+        };
+
+        // Module settings are stored column-wise: type tags and numbers in flat
+        // arrays, names and text values as spans into two string arenas.
+        struct settingsStore {
+            struct arenaSpan {
+                uint32_t offset;
+                uint32_t length;
+            };
+            std::vector<settingType> types;
+            std::vector<double> numbers;
+            std::vector<arenaSpan> names;
+            std::vector<arenaSpan> texts;
+            std::string name_arena;
+            std::string text_arena;
+            size_t text_garbage = 0;
+            // Setting indices ordered by name, searched by find()
+            std::vector<uint32_t> name_index;
+
+            size_t size() const {
+                return types.size();
+            }
+            std::string_view name(size_t index) const {
+                return std::string_view(name_arena).substr(names[index].offset, names[index].length);
+            }
+            std::string_view text(size_t index) const {
+                return std::string_view(text_arena).substr(texts[index].offset, texts[index].length);
+            }
+            void clear();
+            int find(std::string_view name) const; // -1 if there is no such setting
+            size_t add(std::string_view name, settingType type);
+            void set_text(size_t index, std::string_view value);
         };
         
-        static std::vector<settingsVariables> variables;
-        static std::unordered_map<std::string,int> variables_fields;
+        // Settings are published as immutable snapshots. Readers hold a
+        // settingsReadGuard and never block; a writer copies the current
+        // snapshot, edits the copy, publishes it and frees the old one once
+        // every reader that could still see it has left.
+        struct settingsSnapshot {
+            settingsStore variables;
+            unsigned int layout = 0; // changes when settings are added, cleared or retyped
+            unsigned int version = 0; // changes whenever a value changes
+        };
+
+        struct settingsReadGuard {
+            settingsReadGuard();
+            ~settingsReadGuard();
+            settingsReadGuard(const settingsReadGuard&) = delete;
+            settingsReadGuard& operator=(const settingsReadGuard&) = delete;
+            const settingsSnapshot* operator->() const {
+                return snapshot;
+            }
+            unsigned int epoch;
+            const settingsSnapshot* snapshot;
+        };
+
+        static std::atomic<const settingsSnapshot*> settings_current;
+        static std::atomic<unsigned int> settings_epoch;
+        static std::atomic<int> settings_readers[2];
+        static std::mutex settings_write_mutex;
+        // Both expect settings_write_mutex to be held
+        static std::unique_ptr<settingsSnapshot> copy_settings();
+        static void publish_settings(std::unique_ptr<settingsSnapshot> next, bool layout_changed);
+        template <typename T> friend class SettingHandle;
+
+        // Changed setting names are collected here and delivered to the
+        // subscribers by settings_notifier, so one update makes one call
+        typedef void (*settingsCallback)(const std::vector<std::string>& changed_settings);
+        static settingsCallback settings_subscribers[PUARA_SETTINGS_SUBSCRIBERS];
+        static std::mutex settings_subscribers_mutex;
+        static std::vector<std::string> settings_pending;
+        static std::mutex settings_pending_mutex;
+        static TaskHandle_t settings_notifier;
+        static void queue_settings_changes(const settingsSnapshot& previous, const settingsSnapshot& next);
+        static void notify_settings(void *arg);
+
+        struct settingsRow {
+            const settingsStore* variables;
+            size_t index;
+        };
 
         static std::unordered_map<std::string,int> config_fields;
         static std::string device;
@@ -83,6 +224,8 @@ class Puara {
         static unsigned int oscPORT1;
         static std::string oscIP2;
         static unsigned int oscPORT2;
+        // Further OSC destinations: comma separated ip:port[/rate[/priority]]
+        static std::string oscDestinations;
         static unsigned int localPORT;
         
         static bool StaIsConnected;
@@ -109,11 +252,216 @@ class Puara {
         static void ap_event_handler(void* arg, esp_event_base_t event_base, int event_id, void* event_data);
         static void wifi_init();
 
-        static std::string serial_data_str_buffer;
-        static void read_settings_json_internal(std::string& contents, bool merge=false);
-        static void read_config_json_internal(std::string& contents);
+        static void read_settings_json_internal(std::string_view contents, bool merge=false);
+        static void read_config_json_internal(std::string_view contents);
         static void merge_settings_json(std::string& new_contents);
 
+        // Incremental JSON reader: input can be fed in pieces of any size and
+        // every value is reported as an event with its key and nesting depth,
+        // keeping only the current key and value in memory
+        enum jsonEventType {
+            JSON_BEGIN_OBJECT, JSON_END_OBJECT, JSON_BEGIN_ARRAY, JSON_END_ARRAY,
+            JSON_STRING, JSON_NUMBER, JSON_TRUE, JSON_FALSE, JSON_NULL
+        };
+        struct jsonEvent {
+            jsonEventType type;
+            int depth;            // containers open around the value
+            std::string_view key; // empty outside of objects
+            std::string_view text;
+            double number;
+            bool too_long;        // key or text cut at PUARA_JSON_TOKEN_SIZE
+        };
+        struct jsonStream {
+            void (*handler)(void* context, const jsonEvent& event);
+            void* context;
+            int state;
+            int depth;
+            bool error;
+            bool parsing_key;
+            char containers[PUARA_JSON_MAX_DEPTH];
+            unsigned int unicode;
+            int unicode_digits;
+            unsigned int high_surrogate;
+            bool key_too_long;
+            bool token_too_long;
+            std::string key;   // grows up to PUARA_JSON_TOKEN_SIZE bytes
+            std::string token;
+            void begin(void (*event_handler)(void* context, const jsonEvent& event), void* event_context);
+            bool feed(const char* data, size_t length);
+            bool finish();
+            bool append(char c);
+            bool append_utf8(unsigned int code_point);
+            void emit(jsonEventType type, double number = 0);
+            bool open(char container);
+            bool close(char container);
+            void value_done();
+        };
+        // Values collected from a config or settings document, applied only
+        // once the whole document has been read
+        struct jsonField {
+            std::string name;
+            bool is_number;
+            std::string text;
+            double number;
+        };
+        struct jsonCollector {
+            std::vector<jsonField> fields;
+            std::vector<std::string> too_long; // fields left out, see PUARA_JSON_TOKEN_SIZE
+            jsonField current;
+            bool current_too_long;
+            bool in_settings;
+        };
+        static void collect_config_field(void* context, const jsonEvent& event);
+        static void collect_settings_field(void* context, const jsonEvent& event);
+        static bool parse_json(std::string_view contents, jsonCollector& collector, bool settings);
+        static void apply_config_fields(const std::vector<jsonField>& fields);
+        static void apply_settings_fields(const std::vector<jsonField>& fields, bool merge);
+        static uint32_t crc32(uint32_t crc, const void* data, size_t length);
+        // Config and settings are saved as binary records: a recordHeader
+        // followed by count fields, each a 4-byte tag (type, name length,
+        // value length) then the name and the value. The CRC-32 covers
+        // everything after the header. Integers are stored little-endian.
+        struct recordHeader {
+            uint32_t magic;
+            uint16_t version;
+            uint16_t count;
+            uint32_t length;
+            uint32_t crc;
+        };
+        enum recordFieldType : uint8_t {
+            RECORD_NUMBER = 1, // value is a double
+            RECORD_TEXT = 2
+        };
+        struct recordWriter {
+            FILE* file;
+            recordHeader header;
+            bool error;
+        };
+        static const uint32_t config_magic = 0x43415550; // "PUAC"
+        static const uint32_t settings_magic = 0x53415550; // "PUAS"
+        static const uint32_t nvs_schema = 1; // NVS "schema" key written with the config
+        static bool begin_record(recordWriter& record, const char* path, uint32_t magic);
+        static void write_record_bytes(recordWriter& record, const void* data, size_t length);
+        static void write_record_field(recordWriter& record, std::string_view name, std::string_view text);
+        static void write_record_field(recordWriter& record, std::string_view name, double number);
+        static bool finish_record(recordWriter& record, const char* temp_path, const char* path);
+        static bool replace_file(const char* temp_path, const char* path);
+        static bool write_json_file(const char* temp_path, const char* path, std::string_view contents);
+        static bool read_record(const char* path, uint32_t magic, std::vector<jsonField>& fields);
+        // Guards the config fields written by the web server and serial
+        // commands and read by the persistence task
+        static std::mutex config_mutex;
+        static std::vector<jsonField> config_snapshot();
+        static void write_config_fields(recordWriter& record);
+        static void write_settings_fields(recordWriter& record);
+        // Changes are marked dirty and saved by persist_changes once they
+        // have been quiet for PUARA_SAVE_DELAY_MS. A record whose CRC matches
+        // the one on flash is not rewritten.
+        static std::mutex persistence_mutex;
+        static uint32_t config_record_crc;
+        static bool config_record_valid;
+        static uint32_t settings_record_crc;
+        static bool settings_record_valid;
+        static std::atomic<bool> config_dirty;
+        static std::atomic<bool> settings_dirty;
+        static TaskHandle_t persistence_task;
+        // set by reboot_with_delay to have persist_changes write immediately
+        // and notify flush_waiter once done
+        static std::atomic<bool> flush_requested;
+        static TaskHandle_t flush_waiter;
+        static void save_config();
+        static void save_settings();
+        static void persist_changes(void *arg);
+        static void flush_changes();
+        // One UDP socket per OSC destination, opened on the first send: oscIP1/oscPORT1, oscIP2/oscPORT2,
+        // then the entries of oscDestinations. The address, port and priority
+        // are resolved into route whenever the config changes, so a direct
+        // send is a few atomic loads and a sendto().
+        // Rate limits use GCRA, the single-word form of a token bucket:
+        // next_send_us is when the bucket will be full again, and a message
+        // is allowed while that is at most burst_us ahead of now.
+        // In bundle mode, messages are collected into bundle under osc_mutex
+        // until it is full, flush_osc() is called or the deadline timer fires.
+        struct oscDestination {
+            std::atomic<int> socket{-1};
+            // send_osc calls using this slot; a socket replaced by
+            // resolve_osc_destinations is closed once they have finished
+            std::atomic<int> senders{0};
+            std::atomic<uint64_t> route{0};
+            std::atomic<uint32_t> interval_us{0}; // 0 when not rate limited
+            std::atomic<uint32_t> burst_us{0};
+            std::atomic<int64_t> next_send_us{0};
+            char bundle[PUARA_OSC_BUNDLE_SIZE];
+            size_t bundle_length = 0;
+            int64_t bundle_deadline_us = 0;
+        };
+        static oscDestination osc_destinations[PUARA_OSC_DESTINATIONS];
+        // Destinations below this priority are skipped while the link is congested
+        static std::atomic<int> osc_shed_priority;
+        static std::atomic<int64_t> osc_shed_us; // last change of osc_shed_priority
+        static std::atomic<int64_t> osc_failure_us; // last send that failed for lack of buffers
+        static std::atomic<uint32_t> osc_dropped;
+        static bool osc_paced(oscDestination& destination);
+        static void osc_congestion(bool failed);
+        static std::mutex osc_mutex;
+        static std::atomic<bool> osc_bundling;
+        static unsigned int osc_bundle_deadline_ms;
+        // One timer serves every destination: it is armed for the earliest
+        // open bundle and re-armed for the next one when it fires
+        static esp_timer_handle_t osc_bundle_timer;
+        static std::atomic<uint32_t> osc_messages;
+        static std::atomic<uint32_t> osc_packets;
+        static std::atomic<uint32_t> osc_bytes;
+        static void resolve_osc_destinations();
+        static bool open_osc_socket(oscDestination& destination);
+        static bool send_osc_to(oscDestination& target, const void* data, size_t length);
+        static bool send_osc_packet(const oscDestination& destination, uint64_t route, const void* data, size_t length);
+        static bool flush_osc_bundle(oscDestination& destination);
+        static void osc_bundle_deadline(void *arg);
+
+        // Incoming OSC is dispatched through a trie of the registered
+        // addresses, one node per address segment. Children are kept sorted
+        // so a literal segment is found by binary search; a pattern segment
+        // is tested against every child.
+        typedef void (*oscHandler)(const PuaraOSCMessage& message, void* context);
+        struct oscNode {
+            std::string segment;
+            std::vector<int> children;
+            std::vector<std::pair<oscHandler, void*>> handlers;
+        };
+        static std::vector<oscNode> osc_nodes;
+        static std::mutex osc_nodes_mutex;
+        static int osc_receive_socket;
+        static TaskHandle_t osc_receiver;
+        static unsigned int osc_settings_layout;
+        static std::vector<std::unique_ptr<std::string>> osc_setting_names;
+        // Setting writes are collected while a packet is dispatched and
+        // published as one snapshot once it is done
+        struct oscSettingWrite {
+            const std::string* name;
+            bool is_number;
+            double number;
+            std::string_view text; // into the packet being dispatched
+        };
+        static std::vector<oscSettingWrite> osc_setting_writes;
+        // These expect osc_nodes_mutex to be held
+        static bool add_osc_handler(std::string_view address, oscHandler handler, void* context);
+        static void register_osc_settings();
+        static void dispatch_osc_node(int node, const std::string_view* segments, int count,
+                                      const PuaraOSCMessage& message);
+        static bool dispatch_osc_packet(char* data, size_t length, int depth);
+        static void osc_setting_handler(const PuaraOSCMessage& message, void* context);
+        static void publish_osc_settings();
+        static void osc_save_handler(const PuaraOSCMessage& message, void* context);
+        static void start_osc_receiver();
+        static void receive_osc(void *arg);
+        static bool nvs_initialized;
+        static void init_nvs();
+#ifdef PUARA_CONFIG_NVS
+        static bool read_config_nvs();
+        static bool write_config_nvs();
+#endif
+
         static httpd_handle_t webserver;
         static httpd_config_t webserver_config;
         static httpd_uri_t index;
@@ -125,6 +473,12 @@ class Puara {
         static httpd_uri_t indexpost;
         static httpd_uri_t settings;
         static httpd_uri_t settingspost;
+        static httpd_uri_t apiconfig;
+        static httpd_uri_t apiconfigput;
+        static httpd_uri_t apiconfigpatch;
+        static httpd_uri_t apisettings;
+        static httpd_uri_t apisettingsput;
+        static httpd_uri_t apisettingspatch;
         static esp_err_t index_get_handler(httpd_req_t *req);
         static esp_err_t get_handler(httpd_req_t *req);
         static esp_err_t style_get_handler(httpd_req_t *req);
@@ -132,28 +486,238 @@ class Puara {
         static esp_err_t settings_post_handler(httpd_req_t *req);
         static esp_err_t scan_get_handler(httpd_req_t *req);
         static esp_err_t index_post_handler(httpd_req_t *req);
-        static std::string prepare_index();
-        static void find_and_replace(std::string old_text, std::string new_text, std::string &str);
-        static void find_and_replace(std::string old_text, double new_number, std::string &str);
-        static void find_and_replace(std::string old_text, unsigned int new_number, std::string &str);
-        static void checkmark(std::string old_text, bool value, std::string & str);
+        // Incremental application/x-www-form-urlencoded decoder. Each key=value
+        // pair is percent-decoded into a buffer as the body arrives and handed
+        // to the handler once complete; the value is null-terminated. Fields
+        // longer than PUARA_FORM_FIELD_SIZE are listed in too_long instead.
+        struct formDecoder {
+            void (*handler)(void* context, std::string_view key, std::string_view value);
+            void* context;
+            std::string field;
+            std::vector<std::string> too_long;
+            size_t key_length;
+            bool in_value;
+            bool overflow;
+            int escape; // hex digits seen after '%'
+            char escape_digit;
+            void begin(void (*field_handler)(void* context, std::string_view key, std::string_view value), void* field_context);
+            void feed(const char* data, size_t size);
+            void finish();
+            void append(char c);
+            void flush_escape();
+            void emit();
+        };
+        static esp_err_t receive_form(httpd_req_t *req, formDecoder& form);
+        struct configForm {
+            bool reboot;
+            bool persistentAP;
+            std::vector<std::pair<int, std::string>> fields;
+        };
+        static void index_form_field(void* context, std::string_view key, std::string_view value);
+        static void apply_index_form_field(configForm* form, int field, std::string_view value);
+        static void settings_form_field(void* context, std::string_view key, std::string_view value);
+        // JSON API: /api/config and /api/settings answer GET with the current
+        // values and accept PUT (whole document) or PATCH (some fields)
+        struct configKey {
+            std::string_view name;
+            bool is_number;
+            bool secret; // accepted by PUT/PATCH but never returned by GET
+        };
+        static const configKey config_keys[];
+        static const size_t config_keys_count;
+        static esp_err_t api_config_get_handler(httpd_req_t *req);
+        static esp_err_t api_config_put_handler(httpd_req_t *req);
+        static esp_err_t api_settings_get_handler(httpd_req_t *req);
+        static esp_err_t api_settings_put_handler(httpd_req_t *req);
+        static esp_err_t receive_json(httpd_req_t *req, jsonCollector& collector, bool settings);
+        // Web pages are parsed once into literal spans and %TOKEN% slots,
+        // so a render is a single pass over the segment list
+        enum templateFields {
+            TEMPLATE_DMINAME, TEMPLATE_STATUS, TEMPLATE_CURRENTSSID, TEMPLATE_CURRENTPSK,
+            TEMPLATE_CURRENTPERSISTENT, TEMPLATE_DEVICENAME, TEMPLATE_CURRENTOSC1,
+            TEMPLATE_CURRENTPORT1, TEMPLATE_CURRENTOSC2, TEMPLATE_CURRENTPORT2,
+            TEMPLATE_CURRENTLOCALPORT, TEMPLATE_CURRENTDESTINATIONS, TEMPLATE_CURRENTSSID2, TEMPLATE_CURRENTIP,
+            TEMPLATE_CURRENTAPIP, TEMPLATE_CURRENTSTAMAC, TEMPLATE_CURRENTAPMAC,
+            TEMPLATE_MODULEID, TEMPLATE_MODULEAUTH, TEMPLATE_MODULEINST, TEMPLATE_MODULEVER,
+            TEMPLATE_SSIDS, TEMPLATE_DATAFROMMODULE, TEMPLATE_PARAMETER, TEMPLATE_PARAMETERVALUE,
+            TEMPLATE_FIELD_COUNT
+        };
+        struct templateSegment {
+            size_t offset;
+            size_t length;
+            int field; // -1 for a literal span of the source
+        };
+        struct pageTemplate {
+            std::string_view source;
+            std::shared_ptr<const std::string> storage; // set when read from SPIFFS
+            std::vector<templateSegment> segments;
+            size_t literal_length;
+            std::string etag; // content hash, combined with config_generation
+        };
+        static std::unordered_map<std::string,int> template_fields;
+        static pageTemplate index_template;
+        static pageTemplate settings_template;
+        static pageTemplate scan_template;
+        static pageTemplate settings_text_row;
+        static pageTemplate settings_number_row;
+        static void compile_templates();
+        static bool read_template(std::string path, pageTemplate& page);
+        static void compile_template(std::string_view source, pageTemplate& page);
+
+        // Rendered pages are sent in PUARA_HTTP_CHUNK_SIZE chunks from a static
+        // buffer (the httpd task serves one request at a time), so a response
+        // never needs to be held in memory as a whole
+        struct responseStream {
+            httpd_req_t *req;
+            size_t length;
+            esp_err_t error;
+            std::string* text = nullptr; // when set, output is collected here instead of sent
+        };
+        typedef void (*templateWriter)(int field, const void* context, responseStream& stream);
+        static char response_buffer[PUARA_HTTP_CHUNK_SIZE];
+        static void stream_write(responseStream& stream, const char* data, size_t length);
+        static void stream_write(responseStream& stream, std::string_view text);
+        static void stream_printf(responseStream& stream, const char* format, ...);
+        static esp_err_t stream_finish(responseStream& stream);
+        static void stream_json_string(responseStream& stream, std::string_view text);
+        static void stream_config_json(responseStream& stream, bool secrets);
+        static void stream_settings_json(responseStream& stream);
+        static void render_template(const pageTemplate& page, templateWriter writer, 
+                                    const void* context, responseStream& stream);
+        // The config shown on the index page, copied under config_mutex so
+        // a slow client does not hold up config writers
+        struct indexPage {
+            std::string dmiName;
+            std::string wifiSSID;
+            std::string wifiPSK;
+            bool persistentAP;
+            std::string device;
+            std::string oscIP1;
+            unsigned int oscPORT1;
+            std::string oscIP2;
+            unsigned int oscPORT2;
+            unsigned int localPORT;
+            std::string oscDestinations;
+            unsigned int id;
+            std::string author;
+            std::string institution;
+        };
+        static void write_index_field(int field, const void* context, responseStream& stream);
+        static void write_settings_field(int field, const void* context, responseStream& stream);
+        static void write_scan_field(int field, const void* context, responseStream& stream);
+        // Files read from SPIFFS are kept in RAM until the file is written again,
+        // least recently used ones are evicted past PUARA_ASSET_CACHE_SIZE bytes
+        struct cachedAsset {
+            std::shared_ptr<const std::string> contents;
+            unsigned int last_used;
+        };
+        static std::unordered_map<std::string,cachedAsset> asset_cache;
+        static size_t asset_cache_size;
+        static unsigned int asset_cache_clock;
+        static std::mutex asset_cache_mutex;
+        static std::shared_ptr<const std::string> get_asset(const std::string& path);
+        static void invalidate_asset(const std::string& path);
+        static esp_err_t send_asset(httpd_req_t *req, const std::string& path);
+        static const puaraAsset* find_embedded_asset(const std::string& path);
+
+        // Conditional GET: static files are tagged by content, rendered pages by
+        // template content plus config_generation, which starts at a random
+        // value each boot and is bumped on every change to what the pages display
+        static std::atomic<unsigned int> config_generation;
+        static std::string content_etag(std::string_view contents);
+        static const char* static_cache_control;
+        static bool etag_listed(std::string_view if_none_match, std::string_view etag);
+        static bool check_not_modified(httpd_req_t *req, const char* etag, const char* cache_control);
+        static bool check_page_not_modified(httpd_req_t *req, const pageTemplate& page, char* etag, size_t size);
         static esp_vfs_spiffs_conf_t spiffs_config;
         static std::string spiffs_base_path;
         static const uint8_t spiffs_max_files = 10;
         static const bool spiffs_format_if_mount_failed = false;
 
+        // The serial monitor task pushes what it reads into a lock-free
+        // single-producer/single-consumer ring and notifies interpret_serial,
+        // which drains it and splits it into commands
+        struct serialRing {
+            char buffer[PUARA_SERIAL_RING_SIZE];
+            std::atomic<size_t> head; // only written by the monitor task
+            std::atomic<size_t> tail; // only written by interpret_serial
+            size_t push(const char* data, size_t length);
+            size_t pop(char* data, size_t length);
+        };
+        // A command ends on a newline outside of any JSON object, or when
+        // the line stays idle for PUARA_SERIAL_IDLE_MS
+        struct serialFrame {
+            std::string data;
+            int depth;
+            bool quoted;
+            bool escaped;
+        };
+        // sendconfig/sendsettings can also announce a framed payload with
+        // "<<<length crc32" on the command line: exactly length bytes follow,
+        // closed by ">>>", and are parsed as they arrive. The payload is
+        // applied only if its CRC-32 matches, and answered with ACK or NAK.
+        struct serialTransfer {
+            bool active;
+            bool settings;
+            size_t remaining;
+            int trailer;
+            uint32_t expected_crc;
+            uint32_t crc;
+            jsonStream parser;
+            jsonCollector collector;
+        };
+        static serialTransfer serial_transfer;
+        static bool begin_transfer(std::string_view header, bool settings);
+        static size_t continue_transfer(const char* data, size_t length);
+        static void end_transfer(const char* error);
+        static serialRing serial_ring;
+        static serialFrame serial_frame;
+        static TaskHandle_t serial_interpreter;
         static char serial_data[PUARA_SERIAL_BUFSIZE];
-        static int serial_data_length;
-        static std::string serial_data_str;
+        static void serial_received(const char* data, size_t length);
+        static void frame_serial(const char* data, size_t length);
+        static void dispatch_serial(std::string_view command);
+
+        // Serial commands: a constexpr table of built-in commands, matched by
+        // length and first character before comparing names, followed by the
+        // commands registered through register_serial_command()
+        struct serialCommand {
+            std::string_view name;
+            void (*handler)(std::string_view arguments);
+        };
+        static const serialCommand serial_commands[];
+        static const size_t serial_commands_count;
+        static serialCommand user_commands[PUARA_SERIAL_USER_COMMANDS];
+        static std::atomic<size_t> user_commands_count;
+        static std::mutex user_commands_mutex;
+        static const serialCommand* find_serial_command(std::string_view name);
+        static void reboot_command(std::string_view arguments);
+        static void ping_command(std::string_view arguments);
+        static void whatareyou_command(std::string_view arguments);
+        static void sendconfig_command(std::string_view arguments);
+        static void writeconfig_command(std::string_view arguments);
+        static void readconfig_command(std::string_view arguments);
+        static void sendsettings_command(std::string_view arguments);
+        static void writesettings_command(std::string_view arguments);
+        static void readsettings_command(std::string_view arguments);
+#ifdef PUARA_BOOT_PROFILE
+        struct bootPhase {
+            const char* name;
+            int64_t end_us; // esp_timer time, microseconds since reset
+        };
+        static bootPhase boot_phases[PUARA_BOOT_PHASES];
+        static std::atomic<size_t> boot_phase_count;
+        static void bootprofile_command(std::string_view arguments);
+        static httpd_uri_t apimetrics;
+        static esp_err_t api_metrics_get_handler(httpd_req_t *req);
+#endif
         static std::string serial_config_str;
-        static std::string convertToString(char* a);
         static void interpret_serial(void *pvParameters);
         static void uart_monitor(void *pvParameters);
         static void jtag_monitor(void *pvParameters);
         static void usb_monitor(void *pvParameters);
         static const int reboot_delay = 3000;
         static void reboot_with_delay(void *pvParameter);
-        static std::string urlDecode(std::string text);
     
     public:
         // Monitor types
@@ -164,6 +728,11 @@ class Puara {
         };
 
         static void start(Monitors monitor = UART_MONITOR); 
+#ifdef PUARA_BOOT_PROFILE
+        // Marks the end of a boot phase; use through PUARA_BOOT_PHASE()
+        static void boot_phase(const char* name);
+        static void report_boot_profile();
+#endif
         static void config_spiffs();
         static httpd_handle_t start_webserver(void);
         static void stop_webserver(void);
@@ -183,23 +752,221 @@ class Puara {
         static void unmount_spiffs();
         static const std::string data_start;
         static const std::string data_end;
+        // Load and save the binary records on SPIFFS. Reading falls back to
+        // importing config.json / settings.json when no valid record exists.
+        static void read_config();
+        static void write_config();
+        static void read_settings();
+        static void write_settings();
+        // JSON import and export of the same data
         static void read_config_json();
         static void write_config_json();
         static void read_settings_json();
         static void write_settings_json();
         static bool start_serial_listening();
         static void send_serial_data(std::string data);
+        // Adds a serial command, dispatched with whatever follows the command
+        // name. Returns false if the name is taken or the table is full.
+        static bool register_serial_command(std::string_view name, void (*handler)(std::string_view arguments));
         static void start_mdns_service(const char * device_name, const char * instance_name);
         static void start_mdns_service(std::string device_name, std::string instance_name);
         static void wifi_scan(void);
         static bool get_StaIsConnected();
         static double getVarNumber (std::string varName);
         static std::string getVarText(std::string varName);
+        // Resolve a setting once and read it through the handle afterwards
+        static SettingHandle<double> getVarNumberHandle(std::string varName);
+        static SettingHandle<std::string> getVarTextHandle(std::string varName);
+        // Calls the callback with the names of the settings changed by each
+        // update (web form, sendsettings, readsettings), on a low priority task.
+        // Returns an id for unsubscribe_settings(), or -1 if the table is full.
+        static int subscribe_settings(void (*callback)(const std::vector<std::string>& changed_settings));
+        static void unsubscribe_settings(int id);
         static bool IP1_ready();
         static bool IP2_ready();
+        // Sends an encoded OSC packet to destination 0 (oscIP1), 1 (oscIP2) or
+        // 2 onwards (oscDestinations). Returns false if that destination is not
+        // configured, is over its rate or is shed because the link is congested.
+        static bool send_osc(int destination, const void* data, size_t length);
+        // Bundle mode collects the messages sent to each destination into one
+        // timetagged OSC bundle, sent on flush_osc() or deadline_ms after its
+        // first message. Disabling it sends anything still pending.
+        static void set_osc_bundling(bool enabled, unsigned int deadline_ms = PUARA_OSC_BUNDLE_DEADLINE_MS);
+        static void flush_osc();
+        struct oscStatistics {
+            uint32_t messages;
+            uint32_t packets;
+            uint32_t bytes;
+            uint32_t dropped; // over the rate limit or shed
+        };
+        static oscStatistics get_osc_statistics();
+        // Calls handler for every incoming OSC message on localPORT whose
+        // address (which may use *, ?, [] and {} patterns) matches. Settings
+        // are registered as /settings/<name>, and /settings/save stores them.
+        // Handlers run on the receiver task and must not register handlers
+        // themselves.
+        static bool register_osc_handler(std::string_view address,
+                                         void (*handler)(const PuaraOSCMessage& message, void* context),
+                                         void* context = nullptr);
 
         // Set default monitor as UART
         static int module_monitor;
 };
 
+// Typed access to one module setting (double for numbers, std::string for text).
+// The name is looked up only when the settings layout changes, so a read is
+// a slot load from the current snapshot and never blocks. Text is copied into
+// the handle when the settings change and returned by reference.
+// changed() reports once after any setting has been modified.
+template <typename T>
+class SettingHandle {
+    static_assert(std::is_same<T, double>::value || std::is_same<T, std::string>::value,
+                  "settings are either double or std::string");
+    public:
+        typedef typename std::conditional<std::is_same<T, double>::value, double, const std::string&>::type value_type;
+
+        SettingHandle() : slot(-1), layout(0), seen_version(0), value_version(0) {}
+        explicit SettingHandle(std::string setting_name) 
+            : name(setting_name), slot(-1), layout(0), seen_version(0), value_version(0) {
+            Puara::settingsReadGuard guard;
+            seen_version = guard->version;
+            resolve(*guard.snapshot);
+        }
+
+        bool valid() {
+            Puara::settingsReadGuard guard;
+            refresh(*guard.snapshot);
+            return slot >= 0;
+        }
+
+        value_type get() {
+            Puara::settingsReadGuard guard;
+            refresh(*guard.snapshot);
+            if (slot < 0) {
+                return empty_value();
+            }
+            return value(*guard.snapshot);
+        }
+
+        bool changed() {
+            Puara::settingsReadGuard guard;
+            if (guard->version == seen_version) {
+                return false;
+            }
+            seen_version = guard->version;
+            return true;
+        }
+
+        const std::string& get_name() const {
+            return name;
+        }
+
+    private:
+        std::string name;
+        int slot;
+        unsigned int layout;
+        unsigned int seen_version;
+        unsigned int value_version;
+        std::string text;
+
+        void refresh(const Puara::settingsSnapshot& snapshot) {
+            if (layout != snapshot.layout) {
+                resolve(snapshot);
+            }
+        }
+
+        void resolve(const Puara::settingsSnapshot& snapshot) {
+            layout = snapshot.layout;
+            value_version = snapshot.version - 1;
+            int field = snapshot.variables.find(name);
+            bool is_number = std::is_same<T, double>::value;
+            if (field >= 0 && (snapshot.variables.types[field] == Puara::SETTING_NUMBER) == is_number) {
+                slot = field;
+            } else {
+                slot = -1;
+            }
+        }
+
+        value_type value(const Puara::settingsSnapshot& snapshot);
+        value_type empty_value();
+};
+
+template <>
+inline double SettingHandle<double>::value(const Puara::settingsSnapshot& snapshot) {
+    return snapshot.variables.numbers[slot];
+}
+
+template <>
+inline double SettingHandle<double>::empty_value() {
+    return 0;
+}
+
+template <>
+inline const std::string& SettingHandle<std::string>::value(const Puara::settingsSnapshot& snapshot) {
+    if (value_version != snapshot.version) {
+        text.assign(snapshot.variables.text(slot));
+        value_version = snapshot.version;
+    }
+    return text;
+}
+
+template <>
+inline const std::string& SettingHandle<std::string>::empty_value() {
+    text.clear();
+    return text;
+}
+
+// OSC message with a fixed layout. begin() writes the padded address and type
+// tags once and reserves a slot per argument; set() patches a value in place,
+// so sending at sensor rate does no allocation or formatting.
+// Supported types: 'i' (int32), 'f' (float32), 'h' (int64), 'd' (float64).
+class PuaraOSC {
+    public:
+        PuaraOSC() : length(0), count(0) {}
+        PuaraOSC(const char* address, const char* type_tags) : length(0), count(0) {
+            begin(address, type_tags);
+        }
+
+        // type_tags lists one tag per argument, without the leading comma
+        bool begin(const char* address, const char* type_tags);
+        void set(int index, int32_t value);
+        void set(int index, int64_t value);
+        void set(int index, float value);
+        void set(int index, double value);
+        // Sends to one destination (see Puara::send_osc), or to all of them
+        bool send(int destination);
+        bool send();
+
+        const char* data() const {
+            return packet;
+        }
+        size_t size() const {
+            return length;
+        }
+
+    private:
+        char packet[PUARA_OSC_MESSAGE_SIZE];
+        size_t length;
+        int count;
+        char types[PUARA_OSC_MAX_ARGS];
+        uint16_t offsets[PUARA_OSC_MAX_ARGS];
+
+        void store_integer(int index, int64_t value);
+        void store_float(int index, double value);
+};
+
+// An incoming OSC message, parsed in place in the receive buffer. Arguments
+// point at their big-endian data; number() converts i, f, h, d, T and F, and
+// text() returns s and S arguments.
+struct PuaraOSCMessage {
+    std::string_view address;
+    std::string_view types; // type tags, without the leading comma
+    const char* arguments[PUARA_OSC_MAX_ARGS];
+
+    bool is_number(size_t index) const;
+    double number(size_t index) const;
+    bool is_text(size_t index) const;
+    std::string_view text(size_t index) const;
+};
+
 #endif
\ No newline at end of file
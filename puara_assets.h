@@ -0,0 +1,906 @@
+// Generated by tools/embed_assets.py from data/, do not edit.
+
+#ifndef PUARA_ASSETS_H
+#define PUARA_ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct puaraAsset {
+    const char* name;
+    const char* mime_type;
+    const char* etag;
+    bool gzipped;
+    const uint8_t* data;
+    size_t length;
+};
+
+// factory.html: 2128 bytes
+static constexpr uint8_t puara_asset_factory_html[] = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+    0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74,
+    0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65,
+    0x61, 0x64, 0x3e, 0x0a, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x22, 0x3e, 0x43,
+    0x6f, 0x6e, 0x66, 0x69, 0x67, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b,
+    0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x2f, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x63, 0x61, 0x6e,
+    0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70,
+    0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x74,
+    0x69, 0x6e, 0x67, 0x73, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x65, 0x74, 0x74, 0x69,
+    0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31,
+    0x3e, 0x25, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4e, 0x41, 0x4d, 0x45, 0x25, 0x3c, 0x68, 0x31,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+    0x3e, 0x25, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x25, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x53, 0x65,
+    0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e,
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22,
+    0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74, 0x22, 0x3e,
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d,
+    0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x49, 0x44, 0x22,
+    0x3e, 0x49, 0x44, 0x20, 0x28, 0x73, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x20, 0x23, 0x29, 0x3c, 0x2f,
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74,
+    0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x49, 0x44, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+    0x49, 0x44, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x47, 0x55, 0x49, 0x54,
+    0x41, 0x52, 0x41, 0x4d, 0x49, 0x49, 0x44, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+    0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d,
+    0x22, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x22, 0x3e, 0x46, 0x69, 0x72, 0x6d, 0x77,
+    0x61, 0x72, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6c, 0x61, 0x62,
+    0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69,
+    0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69,
+    0x64, 0x3d, 0x22, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d,
+    0x65, 0x3d, 0x22, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x22, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x3d, 0x22, 0x25, 0x47, 0x55, 0x49, 0x54, 0x41, 0x52, 0x41, 0x4d, 0x49, 0x56, 0x45,
+    0x52, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64,
+    0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x66, 0x69, 0x72, 0x6d, 0x77,
+    0x61, 0x72, 0x65, 0x22, 0x3e, 0x54, 0x6f, 0x75, 0x63, 0x68, 0x20, 0x53, 0x65, 0x6e, 0x73, 0x69,
+    0x74, 0x69, 0x76, 0x69, 0x74, 0x79, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x74, 0x6f,
+    0x75, 0x63, 0x68, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x74, 0x6f, 0x75, 0x63, 0x68,
+    0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x54, 0x4f, 0x55, 0x43, 0x48, 0x25,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f,
+    0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22,
+    0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28,
+    0x27, 0x53, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
+    0x73, 0x20, 0x74, 0x6f, 0x20, 0x47, 0x75, 0x69, 0x74, 0x61, 0x72, 0x41, 0x4d, 0x49, 0x20, 0x6d,
+    0x6f, 0x64, 0x75, 0x6c, 0x65, 0x27, 0x29, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22,
+    0x53, 0x61, 0x76, 0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x72, 0x3e, 0x3c,
+    0x62, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x3d, 0x22, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+    0x74, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d,
+    0x22, 0x72, 0x65, 0x62, 0x6f, 0x6f, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22,
+    0x43, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x62, 0x6f, 0x6f, 0x74,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x3c, 0x62, 0x75, 0x74,
+    0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+    0x22, 0x20, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x61, 0x6c, 0x65, 0x72, 0x74,
+    0x28, 0x27, 0x52, 0x65, 0x62, 0x6f, 0x6f, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x20, 0x50, 0x6c, 0x65,
+    0x61, 0x73, 0x65, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x77,
+    0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x27, 0x29, 0x22, 0x3e, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x20,
+    0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x62, 0x6f, 0x6f, 0x74, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74,
+    0x6f, 0x6e, 0x3e, 0x20, 0x2d, 0x2d, 0x3e, 0x20, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x72, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0a, 0x0a,
+    0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+
+// index.html: 7974 bytes
+static constexpr uint8_t puara_asset_index_html[] = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+    0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74,
+    0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65,
+    0x61, 0x64, 0x3e, 0x0a, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x22, 0x3e, 0x43,
+    0x6f, 0x6e, 0x66, 0x69, 0x67, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b,
+    0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x2f, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x63, 0x61, 0x6e,
+    0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70,
+    0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x74,
+    0x69, 0x6e, 0x67, 0x73, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x65, 0x74, 0x74, 0x69,
+    0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31,
+    0x3e, 0x25, 0x44, 0x4d, 0x49, 0x4e, 0x41, 0x4d, 0x45, 0x25, 0x3c, 0x68, 0x31, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x25, 0x53,
+    0x54, 0x41, 0x54, 0x55, 0x53, 0x25, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x43, 0x6f, 0x6e, 0x66, 0x69,
+    0x67, 0x3a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f,
+    0x72, 0x6d, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74, 0x22,
+    0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x23, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f,
+    0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x3e,
+    0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x3a, 0x20, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+    0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x53, 0x53, 0x49, 0x44, 0x22, 0x3e, 0x53, 0x53, 0x49, 0x44,
+    0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d,
+    0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65,
+    0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x53, 0x53, 0x49, 0x44, 0x22, 0x20, 0x6e, 0x61,
+    0x6d, 0x65, 0x3d, 0x22, 0x53, 0x53, 0x49, 0x44, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68,
+    0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x53,
+    0x53, 0x49, 0x44, 0x2e, 0x2e, 0x2e, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25,
+    0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x53, 0x53, 0x49, 0x44, 0x25, 0x22, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20,
+    0x66, 0x6f, 0x72, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x3e, 0x53,
+    0x53, 0x49, 0x44, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3c, 0x2f, 0x6c, 0x61,
+    0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64,
+    0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e,
+    0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f,
+    0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64,
+    0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64,
+    0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x4e,
+    0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x2e,
+    0x2e, 0x2e, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x43, 0x55, 0x52, 0x52,
+    0x45, 0x4e, 0x54, 0x50, 0x53, 0x4b, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64,
+    0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x3e, 0x25, 0x44, 0x45, 0x56, 0x49, 0x43, 0x45, 0x4e, 0x41,
+    0x4d, 0x45, 0x25, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3a, 0x3c, 0x2f, 0x68,
+    0x33, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72,
+    0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c,
+    0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x41, 0x50, 0x70, 0x61, 0x73, 0x73,
+    0x77, 0x64, 0x22, 0x3e, 0x4e, 0x65, 0x77, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64,
+    0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d,
+    0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61,
+    0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x41, 0x50, 0x70, 0x61,
+    0x73, 0x73, 0x77, 0x64, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x50, 0x70, 0x61,
+    0x73, 0x73, 0x77, 0x64, 0x22, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65,
+    0x72, 0x3d, 0x22, 0x28, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20,
+    0x74, 0x6f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20,
+    0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x29, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+    0x3d, 0x22, 0x41, 0x50, 0x70, 0x61, 0x73, 0x73, 0x77, 0x64, 0x56, 0x61, 0x6c, 0x69, 0x64, 0x61,
+    0x74, 0x65, 0x22, 0x3e, 0x52, 0x65, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x70,
+    0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x69,
+    0x64, 0x3d, 0x22, 0x41, 0x50, 0x70, 0x61, 0x73, 0x73, 0x77, 0x64, 0x56, 0x61, 0x6c, 0x69, 0x64,
+    0x61, 0x74, 0x65, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x41, 0x50, 0x70, 0x61, 0x73,
+    0x73, 0x77, 0x64, 0x56, 0x61, 0x6c, 0x69, 0x64, 0x61, 0x74, 0x65, 0x22, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6c, 0x61,
+    0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x28, 0x6c, 0x65, 0x61, 0x76, 0x65,
+    0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x29,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f,
+    0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+    0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x41, 0x50,
+    0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x74, 0x41, 0x50, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x74, 0x72, 0x75,
+    0x65, 0x22, 0x20, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x50, 0x45, 0x52, 0x53, 0x49,
+    0x53, 0x54, 0x45, 0x4e, 0x54, 0x25, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22,
+    0x50, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x41, 0x50, 0x22, 0x3e, 0x20, 0x50,
+    0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x41, 0x50, 0x20, 0x6d, 0x6f, 0x64,
+    0x65, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x3e, 0x4f, 0x53, 0x43, 0x20, 0x73,
+    0x65, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x3c, 0x2f, 0x68,
+    0x33, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72,
+    0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c,
+    0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x49, 0x50, 0x31,
+    0x22, 0x3e, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x72, 0x79, 0x20, 0x49, 0x50, 0x3c, 0x2f, 0x6c, 0x61,
+    0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64,
+    0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e,
+    0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20,
+    0x69, 0x64, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x49, 0x50, 0x31, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x3d, 0x22, 0x6f, 0x73, 0x63, 0x49, 0x50, 0x31, 0x22, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+    0x6e, 0x3d, 0x22, 0x5c, 0x62, 0x28, 0x3f, 0x3a, 0x28, 0x3f, 0x3a, 0x32, 0x35, 0x5b, 0x30, 0x2d,
+    0x35, 0x5d, 0x7c, 0x32, 0x5b, 0x30, 0x2d, 0x34, 0x5d, 0x5c, 0x64, 0x7c, 0x5b, 0x30, 0x31, 0x5d,
+    0x3f, 0x5c, 0x64, 0x5c, 0x64, 0x3f, 0x29, 0x5c, 0x2e, 0x29, 0x7b, 0x33, 0x7d, 0x28, 0x3f, 0x3a,
+    0x32, 0x35, 0x5b, 0x30, 0x2d, 0x35, 0x5d, 0x7c, 0x32, 0x5b, 0x30, 0x2d, 0x34, 0x5d, 0x5c, 0x64,
+    0x7c, 0x5b, 0x30, 0x31, 0x5d, 0x3f, 0x5c, 0x64, 0x5c, 0x64, 0x3f, 0x29, 0x5c, 0x62, 0x22, 0x20,
+    0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x2e, 0x30,
+    0x2e, 0x30, 0x2e, 0x30, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x43, 0x55,
+    0x52, 0x52, 0x45, 0x4e, 0x54, 0x4f, 0x53, 0x43, 0x31, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f,
+    0x72, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x50, 0x4f, 0x52, 0x54, 0x31, 0x22, 0x3e, 0x50, 0x72, 0x69,
+    0x6d, 0x61, 0x72, 0x79, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x69,
+    0x64, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x50, 0x4f, 0x52, 0x54, 0x31, 0x22, 0x20, 0x6e, 0x61, 0x6d,
+    0x65, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x50, 0x4f, 0x52, 0x54, 0x31, 0x22, 0x20, 0x70, 0x6c, 0x61,
+    0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20,
+    0x6d, 0x69, 0x6e, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22, 0x39, 0x39, 0x39,
+    0x39, 0x39, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x43, 0x55, 0x52, 0x52,
+    0x45, 0x4e, 0x54, 0x50, 0x4f, 0x52, 0x54, 0x31, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+    0x3d, 0x22, 0x6f, 0x73, 0x63, 0x49, 0x50, 0x32, 0x22, 0x3e, 0x53, 0x65, 0x63, 0x6f, 0x6e, 0x64,
+    0x61, 0x72, 0x79, 0x20, 0x49, 0x50, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6f, 0x73,
+    0x63, 0x49, 0x50, 0x32, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x49,
+    0x50, 0x32, 0x22, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x3d, 0x22, 0x5c, 0x62, 0x28,
+    0x3f, 0x3a, 0x28, 0x3f, 0x3a, 0x32, 0x35, 0x5b, 0x30, 0x2d, 0x35, 0x5d, 0x7c, 0x32, 0x5b, 0x30,
+    0x2d, 0x34, 0x5d, 0x5c, 0x64, 0x7c, 0x5b, 0x30, 0x31, 0x5d, 0x3f, 0x5c, 0x64, 0x5c, 0x64, 0x3f,
+    0x29, 0x5c, 0x2e, 0x29, 0x7b, 0x33, 0x7d, 0x28, 0x3f, 0x3a, 0x32, 0x35, 0x5b, 0x30, 0x2d, 0x35,
+    0x5d, 0x7c, 0x32, 0x5b, 0x30, 0x2d, 0x34, 0x5d, 0x5c, 0x64, 0x7c, 0x5b, 0x30, 0x31, 0x5d, 0x3f,
+    0x5c, 0x64, 0x5c, 0x64, 0x3f, 0x29, 0x5c, 0x62, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68,
+    0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x2e, 0x30, 0x22, 0x20,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x4f,
+    0x53, 0x43, 0x32, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x2d,
+    0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x6f, 0x73, 0x63,
+    0x50, 0x4f, 0x52, 0x54, 0x32, 0x22, 0x3e, 0x53, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x61, 0x72, 0x79,
+    0x20, 0x70, 0x6f, 0x72, 0x74, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6f,
+    0x73, 0x63, 0x50, 0x4f, 0x52, 0x54, 0x32, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6f,
+    0x73, 0x63, 0x50, 0x4f, 0x52, 0x54, 0x32, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f,
+    0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d,
+    0x22, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22, 0x39, 0x39, 0x39, 0x39, 0x39, 0x22, 0x20,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x50,
+    0x4f, 0x52, 0x54, 0x32, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6c,
+    0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x6c, 0x6f,
+    0x63, 0x61, 0x6c, 0x50, 0x4f, 0x52, 0x54, 0x22, 0x3e, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x70,
+    0x6f, 0x72, 0x74, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63,
+    0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d,
+    0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x6f, 0x63,
+    0x61, 0x6c, 0x50, 0x4f, 0x52, 0x54, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x6f,
+    0x63, 0x61, 0x6c, 0x50, 0x4f, 0x52, 0x54, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f,
+    0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x30, 0x30, 0x30, 0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d,
+    0x22, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22, 0x39, 0x39, 0x39, 0x39, 0x39, 0x22, 0x20,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x4c,
+    0x4f, 0x43, 0x41, 0x4c, 0x50, 0x4f, 0x52, 0x54, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x22, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+    0x3d, 0x22, 0x6f, 0x73, 0x63, 0x44, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x73, 0x22, 0x3e, 0x4d, 0x6f, 0x72, 0x65, 0x20, 0x64, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x73, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+    0x63, 0x6f, 0x6c, 0x2d, 0x37, 0x35, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x44,
+    0x65, 0x73, 0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x20, 0x6e, 0x61, 0x6d,
+    0x65, 0x3d, 0x22, 0x6f, 0x73, 0x63, 0x44, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d,
+    0x22, 0x69, 0x70, 0x3a, 0x70, 0x6f, 0x72, 0x74, 0x2f, 0x72, 0x61, 0x74, 0x65, 0x2f, 0x70, 0x72,
+    0x69, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x2c, 0x20, 0x2e, 0x2e, 0x2e, 0x22, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x3d, 0x22, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x44, 0x45, 0x53, 0x54,
+    0x49, 0x4e, 0x41, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x25, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+    0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f,
+    0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+    0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x4e, 0x65, 0x74, 0x77, 0x6f,
+    0x72, 0x6b, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x3a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62,
+    0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64,
+    0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20,
+    0x53, 0x53, 0x49, 0x44, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x43, 0x55, 0x52, 0x52,
+    0x45, 0x4e, 0x54, 0x53, 0x53, 0x49, 0x44, 0x32, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e,
+    0x74, 0x20, 0x49, 0x50, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x28, 0x53, 0x54,
+    0x41, 0x29, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e,
+    0x54, 0x49, 0x50, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3c, 0x74, 0x64, 0x3e, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x50, 0x6f, 0x69, 0x6e,
+    0x74, 0x20, 0x49, 0x50, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x43, 0x55, 0x52, 0x52,
+    0x45, 0x4e, 0x54, 0x41, 0x50, 0x49, 0x50, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x28, 0x53, 0x54, 0x41, 0x29, 0x20, 0x4d, 0x41, 0x43, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64,
+    0x3e, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54, 0x53, 0x54, 0x41, 0x4d, 0x41, 0x43, 0x25,
+    0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+    0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64,
+    0x3e, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x4d, 0x41,
+    0x43, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x43, 0x55, 0x52, 0x52, 0x45, 0x4e, 0x54,
+    0x41, 0x50, 0x4d, 0x41, 0x43, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+    0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70,
+    0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x63, 0x61, 0x6e, 0x2e,
+    0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x73, 0x63, 0x61,
+    0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x3c, 0x2f,
+    0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a,
+    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32,
+    0x3e, 0x49, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+    0x3a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63,
+    0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x61, 0x62, 0x6c,
+    0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x49, 0x44, 0x20, 0x28, 0x73, 0x65, 0x72, 0x69,
+    0x61, 0x6c, 0x20, 0x23, 0x29, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x4d, 0x4f, 0x44, 0x55, 0x4c, 0x45, 0x49,
+    0x44, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x61, 0x75,
+    0x74, 0x68, 0x6f, 0x72, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x4d, 0x4f, 0x44, 0x55, 0x4c, 0x45, 0x41, 0x55,
+    0x54, 0x48, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74,
+    0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x69, 0x74, 0x75, 0x74,
+    0x69, 0x6f, 0x6e, 0x3a, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x4d, 0x4f, 0x44, 0x55, 0x4c, 0x45, 0x49, 0x4e, 0x53,
+    0x54, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x72,
+    0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x46, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20,
+    0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x64, 0x3e, 0x25, 0x4d, 0x4f, 0x44, 0x55,
+    0x4c, 0x45, 0x56, 0x45, 0x52, 0x25, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+    0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x62, 0x72, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22,
+    0x70, 0x6f, 0x73, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20,
+    0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3d, 0x22, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x20, 0x6e,
+    0x61, 0x6d, 0x65, 0x3d, 0x22, 0x72, 0x65, 0x62, 0x6f, 0x6f, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6c,
+    0x75, 0x65, 0x3d, 0x22, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65,
+    0x62, 0x6f, 0x6f, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x0a,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x72, 0x3e,
+    0x3c, 0x62, 0x72, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x0a, 0x3c,
+    0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+
+// reboot.html: 298 bytes, 198 gzipped
+static constexpr uint8_t puara_asset_reboot_html[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x90, 0xb1, 0x12, 0xc2, 0x20,
+    0x0c, 0x86, 0xf7, 0x3e, 0x45, 0x64, 0x70, 0x6c, 0xcf, 0x59, 0x64, 0xa9, 0xce, 0xf6, 0xd4, 0xc5,
+    0x91, 0xb6, 0xb1, 0x70, 0x22, 0xf4, 0x4c, 0xee, 0xb4, 0x6f, 0x2f, 0x1c, 0x78, 0x6e, 0x32, 0x24,
+    0x24, 0xf7, 0xe5, 0xe7, 0x0f, 0x72, 0xb5, 0x3f, 0xb6, 0x97, 0x6b, 0x77, 0x00, 0xc3, 0x0f, 0xa7,
+    0x2a, 0x99, 0x53, 0xcc, 0xa8, 0x47, 0x55, 0x41, 0x3c, 0xd2, 0x59, 0x7f, 0x87, 0x27, 0xba, 0x9d,
+    0x20, 0x5e, 0x1c, 0x92, 0x41, 0x64, 0x01, 0xbc, 0xcc, 0xb8, 0x13, 0x8c, 0x6f, 0x6e, 0x06, 0x22,
+    0x01, 0xe6, 0x89, 0xb7, 0x42, 0xd4, 0xa9, 0x11, 0xb5, 0x9a, 0x2c, 0x52, 0xc9, 0x3e, 0x8c, 0x4b,
+    0x11, 0x9b, 0x95, 0xd4, 0x85, 0x6d, 0x84, 0x6a, 0x83, 0xbf, 0xd9, 0x49, 0x36, 0x5a, 0xc1, 0xda,
+    0xf7, 0x34, 0x6f, 0x73, 0x84, 0x1f, 0x43, 0x83, 0xf6, 0x75, 0x32, 0x25, 0xd4, 0x39, 0x5e, 0xff,
+    0xa2, 0xc8, 0x6c, 0xfd, 0x44, 0x5f, 0xbc, 0x94, 0x69, 0xa4, 0xca, 0x8f, 0x9b, 0x8d, 0x3a, 0x61,
+    0x1f, 0x42, 0xea, 0xd7, 0xd0, 0x39, 0xd4, 0x84, 0x30, 0xb8, 0x10, 0x23, 0x1b, 0x4b, 0xf0, 0xb2,
+    0x7e, 0x0c, 0xaf, 0x3a, 0x71, 0xd1, 0x7d, 0x76, 0x9d, 0xd6, 0x48, 0x7f, 0xf2, 0x01, 0x62, 0x28,
+    0xb2, 0xfe, 0x2a, 0x01, 0x00, 0x00,
+};
+
+// saved.html: 347 bytes, 230 gzipped
+static constexpr uint8_t puara_asset_saved_html[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x90, 0xb1, 0x52, 0xc4, 0x20,
+    0x10, 0x86, 0xfb, 0x3c, 0xc5, 0x4a, 0x61, 0x99, 0x8c, 0xb5, 0x1c, 0xcd, 0x69, 0x61, 0xa5, 0x33,
+    0x6a, 0x61, 0xb9, 0x21, 0x9b, 0xc0, 0x1c, 0x81, 0x4c, 0x76, 0x73, 0x63, 0xde, 0x5e, 0x38, 0xe2,
+    0xd8, 0x49, 0xc1, 0xee, 0xc2, 0xb7, 0x3f, 0xfb, 0xa3, 0xef, 0x9e, 0x5e, 0xcf, 0x1f, 0x5f, 0x6f,
+    0xcf, 0xe0, 0x64, 0x0e, 0xa6, 0xd1, 0x35, 0xe4, 0x48, 0x38, 0x98, 0x06, 0xf2, 0xd2, 0xc1, 0xc7,
+    0x0b, 0xac, 0x14, 0x4e, 0x8a, 0x65, 0x0f, 0xc4, 0x8e, 0x48, 0x14, 0xc8, 0xbe, 0xd0, 0x49, 0x09,
+    0x7d, 0x4b, 0x67, 0x99, 0x15, 0xb8, 0x95, 0xc6, 0x83, 0x68, 0xcb, 0x41, 0xd6, 0xea, 0xaa, 0x48,
+    0xa3, 0xfb, 0x34, 0xec, 0x87, 0xd8, 0x62, 0x34, 0x1e, 0x6c, 0xa7, 0xcc, 0x39, 0xc5, 0xd1, 0x4f,
+    0xba, 0x43, 0x03, 0xf7, 0xb1, 0xe7, 0xe5, 0xb1, 0xee, 0xf0, 0xc7, 0xb0, 0xc5, 0xd8, 0x96, 0xa1,
+    0x94, 0x79, 0xcf, 0xe9, 0xbf, 0x28, 0x89, 0xf8, 0x38, 0xf1, 0x2f, 0x7e, 0x94, 0xa5, 0xa5, 0xa9,
+    0x8f, 0xbb, 0x07, 0xf3, 0x12, 0xc7, 0xb4, 0xce, 0x28, 0x3e, 0x45, 0x60, 0xbc, 0xd2, 0x00, 0xbc,
+    0x59, 0x4b, 0xcc, 0xe3, 0x16, 0xc2, 0xde, 0xc2, 0x27, 0x13, 0x88, 0x23, 0xb8, 0x99, 0xc6, 0x3e,
+    0x5d, 0x73, 0x99, 0xb2, 0x7b, 0xd9, 0xd6, 0x58, 0xb2, 0x72, 0x37, 0xa3, 0x8f, 0x60, 0x6f, 0xa3,
+    0xc3, 0x82, 0x13, 0xb5, 0x45, 0x38, 0xdb, 0xad, 0x36, 0x8b, 0xef, 0xf2, 0x89, 0x3f, 0xe7, 0x49,
+    0xfb, 0x9e, 0x5b, 0x01, 0x00, 0x00,
+};
+
+// scan.html: 455 bytes
+static constexpr uint8_t puara_asset_scan_html[] = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+    0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74,
+    0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65,
+    0x61, 0x64, 0x3e, 0x0a, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x22, 0x3e, 0x43,
+    0x6f, 0x6e, 0x66, 0x69, 0x67, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b,
+    0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x2f, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x63, 0x61, 0x6e,
+    0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70,
+    0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x74,
+    0x69, 0x6e, 0x67, 0x73, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x65, 0x74, 0x74, 0x69,
+    0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31,
+    0x3e, 0x53, 0x63, 0x61, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x65,
+    0x74, 0x77, 0x6f, 0x72, 0x6b, 0x73, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x70, 0x3e, 0x54, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x49, 0x44, 0x73, 0x20, 0x62, 0x65, 0x6c, 0x6f, 0x77,
+    0x2c, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f,
+    0x72, 0x6b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x73, 0x74,
+    0x65, 0x20, 0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x3c, 0x61, 0x20, 0x68,
+    0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x22, 0x3e, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x67, 0x20, 0x70,
+    0x61, 0x67, 0x65, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x70, 0x3e,
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x3d, 0x22, 0x73, 0x63, 0x61, 0x6e, 0x62, 0x6f, 0x78, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x25, 0x53, 0x53, 0x49, 0x44, 0x53, 0x25, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x0a,
+    0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+};
+
+// settings.html: 578 bytes
+static constexpr uint8_t puara_asset_settings_html[] = {
+    0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+    0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74,
+    0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65,
+    0x61, 0x64, 0x3e, 0x0a, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x22, 0x3e, 0x43,
+    0x6f, 0x6e, 0x66, 0x69, 0x67, 0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b,
+    0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22,
+    0x2f, 0x73, 0x63, 0x61, 0x6e, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x63, 0x61, 0x6e,
+    0x3c, 0x2f, 0x61, 0x3e, 0x20, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x26, 0x6e, 0x62, 0x73, 0x70,
+    0x3b, 0x20, 0x3c, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x74,
+    0x69, 0x6e, 0x67, 0x73, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x53, 0x65, 0x74, 0x74, 0x69,
+    0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x61, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31,
+    0x3e, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x63, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x20, 0x73,
+    0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d,
+    0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x70, 0x6f, 0x73, 0x74, 0x22, 0x20, 0x61, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x68,
+    0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x25, 0x44, 0x41, 0x54, 0x41, 0x46, 0x52, 0x4f, 0x4d, 0x4d, 0x4f, 0x44, 0x55,
+    0x4c, 0x45, 0x25, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+    0x22, 0x72, 0x6f, 0x77, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20,
+    0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x53, 0x61, 0x76, 0x65, 0x22, 0x20, 0x61, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x68,
+    0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e,
+    0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+    0x0a, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d,
+    0x6c, 0x3e,
+};
+
+// style.css: 2601 bytes, 737 gzipped
+static constexpr uint8_t puara_asset_style_css[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x56, 0xdf, 0x6f, 0xda, 0x30,
+    0x10, 0x7e, 0xe7, 0xaf, 0xb0, 0x5a, 0x55, 0xda, 0x2a, 0xb2, 0x06, 0x28, 0xed, 0x16, 0x34, 0x69,
+    0x53, 0xa5, 0x69, 0xcf, 0x7b, 0x9d, 0xfa, 0xe0, 0xd8, 0x07, 0xb1, 0xea, 0xd8, 0x91, 0xed, 0x00,
+    0x5d, 0xc5, 0xff, 0xbe, 0xb3, 0xe3, 0xd0, 0x84, 0xa6, 0x74, 0xdd, 0x13, 0x41, 0xa0, 0xe8, 0xce,
+    0xf7, 0xeb, 0xbb, 0xef, 0xce, 0x5c, 0x92, 0xa7, 0x11, 0xc1, 0x27, 0xd7, 0xdb, 0xc4, 0x8a, 0x3f,
+    0x42, 0xad, 0x32, 0x7c, 0x37, 0x1c, 0x4c, 0x82, 0xa2, 0xc5, 0x68, 0x37, 0x1a, 0x15, 0xae, 0x94,
+    0xf1, 0xd4, 0x52, 0x2b, 0x97, 0x2c, 0x69, 0x29, 0xe4, 0x63, 0x46, 0x7e, 0x82, 0x5c, 0x83, 0x13,
+    0x8c, 0x2e, 0x82, 0x8e, 0x0b, 0x5b, 0x49, 0x8a, 0x72, 0xa1, 0xa4, 0x50, 0x90, 0xe4, 0x52, 0xb3,
+    0x87, 0x46, 0x55, 0x52, 0xb3, 0x12, 0x2a, 0x23, 0x69, 0xb5, 0x25, 0xb4, 0x76, 0xba, 0x91, 0x3a,
+    0xd8, 0xba, 0x84, 0x4a, 0xb1, 0x42, 0x0d, 0x03, 0xe5, 0xc0, 0x84, 0x70, 0x42, 0x55, 0xb5, 0xfb,
+    0xed, 0x1e, 0x2b, 0xf8, 0xea, 0x4f, 0xdc, 0x8f, 0x89, 0x05, 0x09, 0xcc, 0x8d, 0x83, 0x01, 0x35,
+    0x40, 0x63, 0x32, 0x1b, 0xc1, 0x5d, 0x91, 0x91, 0x49, 0x9a, 0x5e, 0x34, 0x0e, 0x2b, 0xca, 0x79,
+    0x28, 0x60, 0x32, 0xad, 0xb6, 0x8b, 0x58, 0x96, 0x2f, 0x05, 0x25, 0x18, 0xd9, 0x6a, 0x29, 0x38,
+    0x39, 0x67, 0x8c, 0x75, 0x75, 0x89, 0xa1, 0x5c, 0xd4, 0x36, 0x23, 0xd7, 0xad, 0x8d, 0x01, 0x04,
+    0x02, 0x32, 0xb2, 0x06, 0xe3, 0xab, 0x93, 0x87, 0x59, 0x55, 0xd4, 0xda, 0x0d, 0xda, 0x9e, 0x5e,
+    0x66, 0xaa, 0x2e, 0x73, 0x30, 0xa7, 0x94, 0x57, 0x26, 0xd4, 0x9a, 0x7a, 0x27, 0x4f, 0x2f, 0x9c,
+    0x73, 0x6a, 0x0b, 0xe0, 0x68, 0xcb, 0xbd, 0x13, 0x34, 0x90, 0x34, 0x87, 0x96, 0x68, 0xbd, 0xc4,
+    0x3a, 0x3f, 0xe9, 0x51, 0xae, 0xf5, 0xd1, 0xb0, 0x75, 0x5e, 0x0a, 0x77, 0xdf, 0x86, 0xa6, 0xec,
+    0x61, 0x65, 0x74, 0xad, 0x78, 0xc2, 0xb4, 0xd4, 0x98, 0xc4, 0xf9, 0xf5, 0xdd, 0xf7, 0x1f, 0xf3,
+    0xe8, 0x31, 0xca, 0x36, 0x85, 0x70, 0x30, 0x80, 0x0d, 0x99, 0xa6, 0x87, 0x00, 0x29, 0xad, 0x60,
+    0x10, 0x96, 0xc9, 0xfe, 0x28, 0xab, 0x8d, 0xf5, 0x5e, 0x2b, 0x2d, 0x86, 0xe8, 0x1d, 0x13, 0xcc,
+    0x0a, 0x8d, 0xc0, 0x1d, 0x49, 0x73, 0x4e, 0xd3, 0xeb, 0x2f, 0xc1, 0xf8, 0x13, 0xc3, 0x01, 0xa4,
+    0x58, 0x71, 0x7b, 0xbc, 0xa4, 0xdb, 0x24, 0x76, 0xf5, 0x73, 0xba, 0x8f, 0xdb, 0xcc, 0x5b, 0x22,
+    0x61, 0xe9, 0xb2, 0xce, 0xc0, 0x45, 0xb1, 0x11, 0xab, 0xa2, 0x27, 0x7f, 0x35, 0xff, 0x81, 0x64,
+    0x96, 0x53, 0xff, 0x39, 0x40, 0xa8, 0x01, 0xa7, 0xc9, 0x4f, 0x26, 0xd3, 0x79, 0xbb, 0x2d, 0xa4,
+    0xa6, 0x18, 0xc8, 0xa7, 0xb1, 0xe8, 0xf2, 0x6f, 0x3a, 0xbf, 0xe8, 0x25, 0xe4, 0x74, 0x95, 0x91,
+    0x9b, 0x36, 0x68, 0x77, 0x2d, 0x34, 0xa6, 0xad, 0xe3, 0xdb, 0xb7, 0x1c, 0xdf, 0xfe, 0x87, 0x63,
+    0xcb, 0xa8, 0xc2, 0x4d, 0x77, 0x82, 0x78, 0x0e, 0x4e, 0xec, 0xbf, 0x57, 0x76, 0x75, 0x49, 0xee,
+    0x24, 0x50, 0xd3, 0xa0, 0x65, 0x09, 0x5d, 0x22, 0x05, 0x89, 0x2b, 0xc0, 0x73, 0xbd, 0x2e, 0x95,
+    0x25, 0x97, 0x57, 0x58, 0xbf, 0xd1, 0x9b, 0xac, 0x51, 0x3d, 0xc5, 0x41, 0x40, 0xaa, 0x2a, 0xac,
+    0xe7, 0xec, 0xec, 0x60, 0xd6, 0x1c, 0xcd, 0x65, 0x64, 0x3c, 0xf3, 0x8e, 0xfd, 0x45, 0xe1, 0x8a,
+    0x10, 0x2b, 0xaf, 0x9d, 0xd3, 0xea, 0x94, 0x26, 0xed, 0x9d, 0x6d, 0xdb, 0xd7, 0xf0, 0x8e, 0x61,
+    0x2c, 0x26, 0x7b, 0xc8, 0xa2, 0x2e, 0x3c, 0x8d, 0x6e, 0x7a, 0x44, 0x37, 0x7b, 0x45, 0x37, 0xdc,
+    0xca, 0x4e, 0xca, 0x88, 0xb7, 0xd3, 0x65, 0x58, 0x9f, 0x2f, 0xd9, 0x30, 0x6b, 0x87, 0x30, 0xf4,
+    0xa9, 0xbf, 0xf1, 0x9f, 0x8b, 0x8f, 0x58, 0x47, 0x50, 0xe6, 0x7b, 0x9b, 0x02, 0x2f, 0x8b, 0xfe,
+    0x96, 0xee, 0x46, 0x6b, 0x6f, 0x02, 0xce, 0xf9, 0xb1, 0x34, 0xfb, 0xce, 0x27, 0xf3, 0xe8, 0xbc,
+    0xea, 0xfe, 0x7b, 0x68, 0x6e, 0x8a, 0xe7, 0x26, 0x0f, 0x00, 0x84, 0xcc, 0xfd, 0x05, 0xb6, 0xd2,
+    0xca, 0x8a, 0x35, 0x10, 0xe4, 0x9e, 0xae, 0x1d, 0x49, 0x90, 0x31, 0xa0, 0x02, 0x7f, 0x2d, 0x33,
+    0x80, 0xaf, 0xc2, 0x62, 0x68, 0x6b, 0x51, 0x44, 0x15, 0xb9, 0xf1, 0xd3, 0xea, 0xcb, 0x85, 0x31,
+    0xa2, 0xf2, 0x00, 0xe1, 0xa0, 0xdb, 0xe8, 0x3d, 0xd9, 0xad, 0xc3, 0x66, 0x12, 0x24, 0x29, 0x82,
+    0x45, 0xf4, 0x92, 0x00, 0x65, 0x05, 0x41, 0xfe, 0x62, 0xb3, 0x85, 0xb2, 0x0e, 0x28, 0xf7, 0x52,
+    0x85, 0x75, 0xe1, 0x89, 0xae, 0xd6, 0x4f, 0xc9, 0xb7, 0x12, 0xb8, 0xa0, 0x6d, 0x60, 0xaa, 0x38,
+    0xf9, 0xd0, 0xd9, 0x14, 0x21, 0xf6, 0xc7, 0x58, 0x64, 0x5c, 0x81, 0x63, 0x12, 0x57, 0xd6, 0x98,
+    0xbc, 0x7a, 0x25, 0x0d, 0x0e, 0xf8, 0x61, 0x5b, 0xe3, 0xd4, 0xec, 0xc2, 0x6f, 0xf7, 0x8a, 0xec,
+    0x4d, 0x0e, 0xae, 0x82, 0xf0, 0x9d, 0x3d, 0xdf, 0x91, 0x6f, 0xfc, 0x27, 0x6b, 0x1c, 0x76, 0xb9,
+    0x32, 0xd0, 0xc1, 0xb6, 0x49, 0xbb, 0xd1, 0xee, 0x2f, 0x64, 0xe3, 0x47, 0x8f, 0x29, 0x0a, 0x00,
+    0x00,
+};
+
+// update.html: 2957 bytes, 1116 gzipped
+static constexpr uint8_t puara_asset_update_html[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x56, 0x6d, 0x6f, 0xdb, 0x36,
+    0x10, 0xfe, 0x9e, 0x5f, 0x71, 0x55, 0xb1, 0x3a, 0x29, 0x22, 0xc9, 0x19, 0x36, 0x20, 0xf0, 0x1b,
+    0xb0, 0x64, 0x31, 0x5a, 0xa0, 0x5b, 0x03, 0x38, 0xfb, 0x30, 0x0c, 0xfb, 0x40, 0x89, 0x94, 0x45,
+    0x84, 0x22, 0x05, 0x92, 0xf2, 0x4b, 0x8b, 0xfc, 0xf7, 0x1d, 0x49, 0xc9, 0x96, 0x32, 0x37, 0x2d,
+    0xb0, 0x4e, 0x31, 0x22, 0x8a, 0xbc, 0xe7, 0xb9, 0x3b, 0xde, 0xf1, 0x8e, 0xb3, 0x57, 0xbf, 0x7e,
+    0xbc, 0x7d, 0xf8, 0xf3, 0xfe, 0x0e, 0x4a, 0x5b, 0x89, 0xc5, 0xd9, 0x2c, 0xbc, 0xf0, 0xcd, 0x08,
+    0x5d, 0x9c, 0x01, 0x3e, 0x33, 0xc1, 0xe5, 0x23, 0x68, 0x26, 0xe6, 0x91, 0xb1, 0x7b, 0xc1, 0x4c,
+    0xc9, 0x98, 0x8d, 0xc0, 0xee, 0x6b, 0x36, 0x8f, 0x2c, 0xdb, 0xd9, 0x34, 0x37, 0x26, 0x82, 0x52,
+    0xb3, 0xa2, 0x95, 0x48, 0xdc, 0x04, 0x72, 0xa5, 0x81, 0x04, 0xd9, 0xfc, 0x74, 0xa0, 0xcb, 0x14,
+    0xdd, 0xc3, 0x67, 0x3f, 0x74, 0x4f, 0xa1, 0xa4, 0x8d, 0x0b, 0x52, 0x71, 0xb1, 0x9f, 0xc0, 0x2f,
+    0x9a, 0x13, 0x71, 0x09, 0xef, 0x98, 0xd8, 0x30, 0xcb, 0x73, 0x72, 0x09, 0x86, 0x48, 0x13, 0x1b,
+    0xa6, 0x79, 0x31, 0xf5, 0x90, 0xa7, 0x33, 0xff, 0x4a, 0xdf, 0xc2, 0x43, 0xc9, 0xe0, 0x37, 0x45,
+    0x89, 0x80, 0xf3, 0x8c, 0xe4, 0x8f, 0x6b, 0xad, 0x1a, 0x49, 0x2f, 0xe0, 0x6d, 0xea, 0x05, 0x92,
+    0xca, 0x2f, 0x1d, 0xf5, 0x50, 0x6e, 0x6a, 0x41, 0x50, 0x87, 0x54, 0x92, 0x4d, 0x0f, 0xd3, 0x48,
+    0xf4, 0x8e, 0x53, 0xca, 0x24, 0x64, 0x7b, 0xa0, 0xac, 0x20, 0x8d, 0xb0, 0x1d, 0x87, 0x7b, 0x6a,
+    0x65, 0xb8, 0xe5, 0x4a, 0x4e, 0xa0, 0xe0, 0x3b, 0x46, 0x07, 0xc0, 0x95, 0x25, 0x7b, 0xe0, 0x12,
+    0x90, 0x37, 0x67, 0x7d, 0xd0, 0xa7, 0x98, 0x4b, 0xca, 0x76, 0x13, 0xb8, 0x1a, 0xca, 0x73, 0x0b,
+    0x4a, 0x82, 0x55, 0xf5, 0x40, 0x03, 0xa1, 0x94, 0xcb, 0x75, 0x8c, 0xd3, 0x08, 0x18, 0x8f, 0xeb,
+    0xdd, 0x00, 0xf4, 0x41, 0xe5, 0xc4, 0x19, 0x00, 0xaa, 0x00, 0x8b, 0x2e, 0x67, 0x6a, 0xd7, 0x47,
+    0x0b, 0x56, 0xd8, 0x09, 0x8c, 0x8f, 0x10, 0x4f, 0xd3, 0xfb, 0xde, 0x72, 0x6a, 0x4b, 0x4f, 0xfc,
+    0xc3, 0x80, 0x77, 0xd9, 0x08, 0x11, 0x16, 0xfb, 0x74, 0x25, 0xe3, 0xeb, 0xd2, 0x7e, 0x49, 0x3c,
+    0xac, 0xf6, 0xe5, 0xd5, 0x86, 0xe9, 0x42, 0xa8, 0xed, 0x04, 0x48, 0x63, 0xd5, 0x00, 0x71, 0x27,
+    0x49, 0x26, 0x18, 0x98, 0x5c, 0x2b, 0x84, 0xf2, 0x02, 0x24, 0x63, 0x94, 0xd1, 0x3e, 0xfa, 0x18,
+    0xb7, 0x38, 0x57, 0x42, 0xe9, 0x09, 0xe8, 0x75, 0x76, 0x3e, 0xbe, 0x04, 0xf7, 0xbb, 0x18, 0xea,
+    0x27, 0x42, 0x38, 0x71, 0xf0, 0x82, 0x5f, 0x25, 0x21, 0x1d, 0x0b, 0xfe, 0x92, 0x9f, 0x86, 0x54,
+    0x37, 0xc2, 0xf1, 0x6c, 0x53, 0x50, 0x35, 0xc9, 0xb9, 0xdd, 0x77, 0x64, 0xc7, 0xd4, 0x0a, 0x69,
+    0x75, 0x8b, 0x99, 0xc9, 0xa4, 0x1d, 0x66, 0x14, 0xea, 0x08, 0xb3, 0x9f, 0x5f, 0x30, 0xe0, 0x75,
+    0xc1, 0xdc, 0xdf, 0x51, 0x6b, 0x45, 0xf4, 0x9a, 0xcb, 0xe7, 0x9b, 0xd4, 0x46, 0x7e, 0x02, 0x3f,
+    0x0e, 0x82, 0x9e, 0x29, 0x4d, 0x19, 0xb2, 0x5c, 0xd5, 0x3b, 0x30, 0x4a, 0x70, 0x0a, 0xaf, 0xaf,
+    0xaf, 0xaf, 0xff, 0x15, 0xd1, 0xeb, 0x2e, 0x42, 0xc3, 0x23, 0x71, 0x2b, 0x94, 0x61, 0x70, 0xd3,
+    0x58, 0x8b, 0x39, 0xd3, 0x99, 0x9e, 0xfb, 0xc9, 0xa3, 0xc9, 0x9d, 0x9d, 0xc4, 0x3f, 0x47, 0x6a,
+    0x0c, 0x25, 0xc1, 0xe8, 0x6b, 0x17, 0xe6, 0xe9, 0xf0, 0x88, 0x1a, 0xfe, 0x89, 0xa1, 0xa5, 0xd7,
+    0x7d, 0x4b, 0xfd, 0xc2, 0xb6, 0x4d, 0x99, 0x4c, 0x09, 0x3a, 0x30, 0x28, 0x68, 0x9d, 0x94, 0x2e,
+    0x47, 0x2e, 0xfb, 0x33, 0x85, 0xca, 0x1b, 0x73, 0xc2, 0x9a, 0xf1, 0xb8, 0x9f, 0xc7, 0x58, 0x58,
+    0x62, 0xca, 0x72, 0xa5, 0x49, 0x38, 0x7f, 0xc3, 0x73, 0x9b, 0x37, 0xda, 0x38, 0x50, 0xad, 0x38,
+    0xc6, 0x43, 0x77, 0x8a, 0x67, 0x69, 0x5b, 0x69, 0xb0, 0xe6, 0xb8, 0x42, 0xd3, 0x56, 0xb0, 0x7a,
+    0x31, 0x23, 0x6d, 0x81, 0x4a, 0xa3, 0x05, 0x06, 0xb6, 0xe0, 0xeb, 0x59, 0x4a, 0x16, 0xf0, 0x46,
+    0x66, 0xa6, 0x9e, 0x86, 0xff, 0x70, 0x94, 0x31, 0x39, 0x91, 0x89, 0xab, 0x84, 0xd1, 0x62, 0x85,
+    0xc3, 0x97, 0x44, 0x9b, 0x9a, 0x12, 0xcb, 0x5a, 0xe1, 0x3f, 0xfc, 0xc7, 0x8b, 0xcc, 0xcc, 0x5a,
+    0x8c, 0xb9, 0xe9, 0xd8, 0xdb, 0x4f, 0x07, 0x09, 0xbb, 0x36, 0x2b, 0xaf, 0x16, 0x4b, 0xae, 0xab,
+    0x2d, 0xd1, 0x2c, 0x5d, 0xdd, 0xbf, 0x5f, 0x2e, 0x57, 0xd0, 0xb4, 0xb4, 0xb8, 0xd4, 0xf9, 0x73,
+    0x5b, 0x2a, 0x17, 0x52, 0x57, 0x11, 0x48, 0xad, 0x55, 0x8d, 0x85, 0xd3, 0x32, 0x48, 0x32, 0x2c,
+    0x47, 0x05, 0xc7, 0x63, 0x47, 0x24, 0x85, 0x5c, 0x70, 0x4c, 0xf4, 0x28, 0x18, 0x15, 0xcd, 0xd2,
+    0xba, 0x53, 0x51, 0x28, 0x5d, 0x81, 0xdf, 0xa8, 0x79, 0x14, 0x52, 0x33, 0xce, 0x14, 0x26, 0x4c,
+    0x35, 0x19, 0x27, 0x3f, 0xe7, 0xd5, 0x34, 0x82, 0x8a, 0xd9, 0x52, 0xd1, 0xf9, 0xe8, 0xfe, 0xe3,
+    0xea, 0x61, 0x04, 0x24, 0x77, 0x21, 0x98, 0x8f, 0x5a, 0x67, 0x97, 0x23, 0x60, 0x32, 0xf7, 0xf5,
+    0x7f, 0x54, 0x61, 0xbd, 0xe4, 0x35, 0xd1, 0x36, 0x75, 0xa4, 0x31, 0x2e, 0x93, 0xd1, 0xe2, 0x10,
+    0xa5, 0x19, 0x97, 0x75, 0x63, 0x43, 0xab, 0x18, 0x39, 0xbb, 0x46, 0x20, 0x49, 0x85, 0xe3, 0x8e,
+    0xe8, 0x0b, 0xa2, 0xa6, 0xc9, 0x2a, 0x6e, 0x47, 0xc0, 0xe9, 0x3c, 0x2a, 0x6e, 0xac, 0x8c, 0x60,
+    0x43, 0x44, 0x83, 0x0b, 0xc1, 0x17, 0xe8, 0x36, 0xa8, 0xc5, 0xcf, 0xbc, 0xf2, 0xef, 0xe4, 0xdd,
+    0xea, 0x7b, 0x79, 0xb7, 0xfa, 0x16, 0xef, 0xcc, 0x09, 0xef, 0x42, 0xd4, 0x4f, 0xfa, 0xf6, 0x2a,
+    0x8e, 0x7b, 0x8d, 0x2f, 0x8e, 0x5b, 0x19, 0xca, 0x37, 0x9e, 0xad, 0xda, 0xfb, 0x85, 0x08, 0x43,
+    0x4f, 0x8c, 0xc1, 0x6f, 0xff, 0xd5, 0x82, 0x0f, 0x04, 0x01, 0xdc, 0x15, 0xb2, 0x8e, 0xe4, 0x40,
+    0xd4, 0xc7, 0x76, 0xe5, 0x2e, 0x3a, 0xca, 0x78, 0x39, 0x53, 0x13, 0xd9, 0x09, 0xfa, 0x43, 0x1d,
+    0x2d, 0xde, 0x58, 0x5e, 0x31, 0x33, 0xc5, 0x13, 0x88, 0x6b, 0xcf, 0xc4, 0xeb, 0x70, 0x32, 0x30,
+    0xd3, 0x93, 0x24, 0xc1, 0x7e, 0xc9, 0x08, 0xe6, 0x2e, 0x55, 0x78, 0xa6, 0x71, 0x4f, 0x1a, 0xed,
+    0x9a, 0x5b, 0xe8, 0x6e, 0xa8, 0xb4, 0xc1, 0xfb, 0x83, 0xf7, 0xd1, 0xec, 0x8d, 0x65, 0x15, 0x96,
+    0x3b, 0x6c, 0x1f, 0x9a, 0x65, 0x0a, 0x65, 0xb7, 0x25, 0x36, 0x6a, 0x8a, 0x85, 0xc0, 0x27, 0xf3,
+    0x81, 0x3e, 0x45, 0xb3, 0xbb, 0x1d, 0xea, 0x8f, 0xb1, 0xf7, 0xf0, 0xda, 0x1e, 0x05, 0x37, 0x44,
+    0x43, 0xb8, 0x17, 0xcc, 0x91, 0x25, 0x6f, 0x2a, 0xf4, 0x2c, 0x59, 0x33, 0x7b, 0x27, 0x98, 0x1b,
+    0xde, 0xec, 0xdf, 0xd3, 0xf3, 0xc3, 0x1e, 0xf6, 0x9a, 0x86, 0xc3, 0x15, 0x99, 0x95, 0x2f, 0xc1,
+    0x7c, 0x9a, 0x3e, 0xc3, 0x98, 0xaf, 0x60, 0xcc, 0x29, 0x8c, 0xdb, 0xd9, 0x93, 0x18, 0x73, 0xb3,
+    0xbf, 0x75, 0x3b, 0xfe, 0x3b, 0xe6, 0xd8, 0x79, 0xbb, 0xeb, 0x17, 0x7f, 0x8d, 0xff, 0xee, 0xd5,
+    0x63, 0xd4, 0x97, 0x28, 0x19, 0xce, 0xfd, 0x1c, 0x8a, 0x46, 0xfa, 0xd4, 0x86, 0xf3, 0x8b, 0x5e,
+    0xb5, 0xf5, 0xfd, 0xc8, 0x79, 0x98, 0x84, 0xbb, 0x5a, 0x7b, 0x31, 0x42, 0xf9, 0x28, 0x13, 0x2a,
+    0x7f, 0x8c, 0x8e, 0x7c, 0x4f, 0x87, 0x91, 0xf9, 0xff, 0x98, 0xd1, 0xdf, 0xff, 0xc2, 0xec, 0xda,
+    0xc2, 0x49, 0xe2, 0x2d, 0xde, 0xc1, 0xd4, 0xf6, 0x24, 0x35, 0xdb, 0xe0, 0x76, 0x3e, 0xe7, 0xc7,
+    0x1b, 0x4a, 0x58, 0x48, 0x2c, 0x16, 0x0d, 0x66, 0x61, 0x3e, 0x0f, 0x3a, 0x9f, 0x0b, 0x7e, 0xbb,
+    0x31, 0x43, 0x83, 0x9e, 0xda, 0x04, 0xed, 0xb2, 0x12, 0x5b, 0x54, 0x1a, 0x7a, 0x94, 0xbb, 0x29,
+    0xbb, 0x6b, 0xf7, 0x3f, 0xa7, 0xbb, 0x7e, 0xa1, 0x8d, 0x0b, 0x00, 0x00,
+};
+
+static constexpr puaraAsset puara_assets[] = {
+    {"factory.html", "text/html", "\"b836bff9db281309\"", false, puara_asset_factory_html, sizeof(puara_asset_factory_html)},
+    {"index.html", "text/html", "\"248a71c802407efb\"", false, puara_asset_index_html, sizeof(puara_asset_index_html)},
+    {"reboot.html", "text/html", "\"704dabbdd64ff174\"", true, puara_asset_reboot_html, sizeof(puara_asset_reboot_html)},
+    {"saved.html", "text/html", "\"d52aa0071c326290\"", true, puara_asset_saved_html, sizeof(puara_asset_saved_html)},
+    {"scan.html", "text/html", "\"b1fa3436f22cfd89\"", false, puara_asset_scan_html, sizeof(puara_asset_scan_html)},
+    {"settings.html", "text/html", "\"cf0d7e75a84a649e\"", false, puara_asset_settings_html, sizeof(puara_asset_settings_html)},
+    {"style.css", "text/css", "\"7df0292b7fb1c4cb\"", true, puara_asset_style_css, sizeof(puara_asset_style_css)},
+    {"update.html", "text/html", "\"8a3390bee342d311\"", true, puara_asset_update_html, sizeof(puara_asset_update_html)},
+};
+
+static constexpr size_t puara_assets_count = sizeof(puara_assets) / sizeof(puara_assets[0]);
+
+#endif
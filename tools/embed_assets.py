@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+#
+# Puara Module Manager - web asset embedding
+# Metalab - Société des Arts Technologiques (SAT)
+# Input Devices and Music Interaction Laboratory (IDMIL), McGill University
+#
+# Compresses every web page and stylesheet in data/ and writes them to
+# puara_assets.h as constexpr byte arrays, so the webserver can serve them
+# straight from flash. Pages holding %TOKEN% placeholders are stored
+# uncompressed, as they are rendered on the device before being sent.
+#
+# Usage: python3 tools/embed_assets.py [data_dir] [output_header]
+# Run it again whenever a file in data/ changes.
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+MIME_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+TEMPLATE_TOKEN = re.compile(rb"%[A-Z0-9]+%")
+
+
+def c_identifier(name):
+    return "puara_asset_" + re.sub(r"[^0-9A-Za-z]", "_", name)
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    data_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, "data")
+    output = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "puara_assets.h")
+
+    assets = []
+    for name in sorted(os.listdir(data_dir)):
+        extension = os.path.splitext(name)[1]
+        if extension not in MIME_TYPES:
+            continue  # config.json and settings.json stay on SPIFFS
+        with open(os.path.join(data_dir, name), "rb") as f:
+            raw = f.read()
+        etag = hashlib.sha1(raw).hexdigest()[:16]
+        template = TEMPLATE_TOKEN.search(raw) is not None
+        data = raw if template else gzip.compress(raw, compresslevel=9, mtime=0)
+        assets.append((name, MIME_TYPES[extension], etag, not template, data, len(raw)))
+
+    with open(output, "w", newline="\n") as f:
+        f.write("// Generated by tools/embed_assets.py from data/, do not edit.\n\n")
+        f.write("#ifndef PUARA_ASSETS_H\n#define PUARA_ASSETS_H\n\n")
+        f.write("#include <stddef.h>\n#include <stdint.h>\n\n")
+        f.write("struct puaraAsset {\n"
+                "    const char* name;\n"
+                "    const char* mime_type;\n"
+                "    const char* etag;\n"
+                "    bool gzipped;\n"
+                "    const uint8_t* data;\n"
+                "    size_t length;\n"
+                "};\n\n")
+        for name, mime, etag, gzipped, data, raw_length in assets:
+            f.write("// %s: %d bytes%s\n" % (
+                name, raw_length, ", %d gzipped" % len(data) if gzipped else ""))
+            f.write("static constexpr uint8_t %s[] = {\n%s\n};\n\n" % (c_identifier(name), c_bytes(data)))
+        f.write("static constexpr puaraAsset puara_assets[] = {\n")
+        for name, mime, etag, gzipped, data, raw_length in assets:
+            f.write('    {"%s", "%s", "\\"%s\\"", %s, %s, sizeof(%s)},\n' % (
+                name, mime, etag, "true" if gzipped else "false", c_identifier(name), c_identifier(name)))
+        f.write("};\n\n")
+        f.write("static constexpr size_t puara_assets_count = sizeof(puara_assets) / sizeof(puara_assets[0]);\n\n")
+        f.write("#endif\n")
+
+
+if __name__ == "__main__":
+    main()
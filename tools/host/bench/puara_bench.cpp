@@ -0,0 +1,415 @@
+// Latency and allocation benchmarks of the module's hot paths on the host.
+// Prints one JSON document on stdout; the module's own messages are dropped.
+//
+//   puara_bench [iterations]
+//
+// Latencies are per operation in nanoseconds; allocations and bytes are the
+// operator new calls made by the benchmarking thread, per operation.
+
+#include <puara.h>
+#include <puara_host.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static thread_local size_t allocations = 0;
+static thread_local size_t allocated_bytes = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    allocated_bytes += size;
+    if (void* memory = malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+    free(memory);
+}
+
+class PuaraTest {
+    public:
+        static void run();
+};
+
+static size_t iterations = 2000;
+static std::string results;
+
+// Runs body count times and appends its percentiles to results, followed by
+// any extra fields, given as JSON members
+template <typename Body>
+static void bench(const std::string& name, Body body, size_t count = iterations, const std::string& extra = "") {
+    std::vector<int64_t> times;
+    times.reserve(count);
+    body(); // warm up caches and lazily built state
+    size_t start_allocations = allocations;
+    size_t start_bytes = allocated_bytes;
+    for (size_t i = 0; i < count; i++) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+    size_t operation_allocations = allocations - start_allocations;
+    size_t operation_bytes = allocated_bytes - start_bytes;
+    std::sort(times.begin(), times.end());
+    auto percentile = [&](double p) {
+        return times[std::min(times.size() - 1, static_cast<size_t>(p * times.size()))];
+    };
+    std::ostringstream entry;
+    entry << (results.empty() ? "" : ",\n") << "    {\"name\": \"" << name << "\", \"iterations\": " << count
+          << ", \"ns\": {\"p50\": " << percentile(0.50) << ", \"p90\": " << percentile(0.90)
+          << ", \"p99\": " << percentile(0.99) << ", \"max\": " << times.back() << "}"
+          << ", \"allocations\": " << static_cast<double>(operation_allocations) / count
+          << ", \"bytes\": " << static_cast<double>(operation_bytes) / count << extra << "}";
+    results += entry.str();
+}
+
+static std::string read_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    return contents.str();
+}
+
+static std::string data_file(const std::string& name) {
+    const char* directory = getenv("PUARA_HOST_DATA");
+    return read_file(std::string(directory ? directory : "data") + "/" + name);
+}
+
+// A settings document of count entries, every fourth one text
+static std::string settings_document(int count) {
+    std::string document = "{\"settings\": [";
+    for (int i = 0; i < count; i++) {
+        document += (i ? ", " : "") + std::string("{\"name\": \"setting") + std::to_string(i) + "\", \"value\": ";
+        document += (i % 4 == 0) ? "\"text " + std::to_string(i) + "\"}" : std::to_string(i * 0.5) + "}";
+    }
+    return document + "]}";
+}
+
+// The page substitution done before templates were compiled: one search of
+// the whole page per token and a copy of the tail for each replacement
+static void find_and_replace(std::string old_text, std::string new_text, std::string& str) {
+    std::size_t old_text_position = str.find(old_text);
+    while (old_text_position != std::string::npos) {
+        str.replace(old_text_position, old_text.length(), new_text);
+        old_text_position = str.find(old_text);
+    }
+}
+
+void PuaraTest::run() {
+    char directory[] = "/tmp/puara_bench_XXXXXX";
+    puara_host_spiffs_directory(mkdtemp(directory));
+    Puara::config_spiffs();
+    std::ofstream(puara_host_spiffs_path("/spiffs/config.json")) << data_file("config.json");
+    std::ofstream(puara_host_spiffs_path("/spiffs/settings.json")) << data_file("settings.json");
+
+    const std::string config = data_file("config.json");
+    bench("read_config_json_internal", [&] {
+        Puara::read_config_json_internal(config);
+    });
+    for (int count : {10, 100, 1000}) {
+        const std::string document = settings_document(count);
+        bench("read_settings_json_internal/" + std::to_string(count), [&] {
+            Puara::read_settings_json_internal(document);
+        });
+    }
+
+    // Binary records, or NVS in puara_bench_nvs, against the JSON files
+    // they replace; the first read_config imports config.json and saves it,
+    // so the write_config runs find the config unchanged
+#ifdef PUARA_CONFIG_NVS
+    const std::string backend = "nvs";
+#else
+    const std::string backend = "record";
+#endif
+    Puara::read_config();
+    bench("read_config/" + backend, [&] {
+        Puara::read_config();
+    });
+    bench("read_config_json", [&] {
+        Puara::read_config_json();
+    });
+    bench("write_config/" + backend, [&] {
+        Puara::write_config();
+    });
+    bench("write_config_json", [&] {
+        Puara::write_config_json();
+    });
+
+    // Index page: compiled template against the per-token find_and_replace,
+    // both answered through the same request path
+    Puara::compile_templates();
+    bench("index_get_handler/template", [&] {
+        puara_host_request(Puara::index_get_handler, HTTP_GET, "/");
+    });
+    bench("index_get_handler/find_and_replace", [&] {
+        puara_host_request([](httpd_req_t* req) {
+            std::string contents(Puara::index_template.source);
+            find_and_replace("%DMINAME%", Puara::dmiName, contents);
+            find_and_replace("%STATUS%", "Currently not connected to any network", contents);
+            find_and_replace("%CURRENTSSID%", Puara::currentSSID, contents);
+            find_and_replace("%CURRENTPSK%", Puara::wifiPSK, contents);
+            find_and_replace("%CURRENTPERSISTENT%", Puara::persistentAP ? "checked" : "", contents);
+            find_and_replace("%DEVICENAME%", Puara::device, contents);
+            find_and_replace("%CURRENTOSC1%", Puara::oscIP1, contents);
+            find_and_replace("%CURRENTPORT1%", std::to_string(Puara::oscPORT1), contents);
+            find_and_replace("%CURRENTOSC2%", Puara::oscIP2, contents);
+            find_and_replace("%CURRENTPORT2%", std::to_string(Puara::oscPORT2), contents);
+            find_and_replace("%CURRENTLOCALPORT%", std::to_string(Puara::localPORT), contents);
+            find_and_replace("%CURRENTSSID2%", Puara::wifiSSID, contents);
+            find_and_replace("%CURRENTIP%", Puara::currentSTA_IP, contents);
+            find_and_replace("%CURRENTAPIP%", Puara::currentAP_IP, contents);
+            find_and_replace("%CURRENTSTAMAC%", Puara::currentSTA_MAC, contents);
+            find_and_replace("%CURRENTAPMAC%", Puara::currentAP_MAC, contents);
+            find_and_replace("%MODULEID%", std::to_string(Puara::id), contents);
+            find_and_replace("%MODULEAUTH%", Puara::author, contents);
+            find_and_replace("%MODULEINST%", Puara::institution, contents);
+            find_and_replace("%MODULEVER%", std::to_string(Puara::version), contents);
+            return httpd_resp_sendstr(req, contents.c_str());
+        }, HTTP_GET, "/");
+    });
+
+    // Reading a setting from a sensor loop: by name against a typed handle,
+    // 1000 reads per operation
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    volatile double number_sink = 0;
+    volatile size_t text_sink = 0;
+    bench("getVarNumber/1000", [&] {
+        for (int i = 0; i < 1000; i++) {
+            number_sink = Puara::getVarNumber("answer_to_everything");
+        }
+    });
+    bench("getVarText/1000", [&] {
+        for (int i = 0; i < 1000; i++) {
+            text_sink = Puara::getVarText("Hitchhiker").size();
+        }
+    });
+    SettingHandle<double> answer("answer_to_everything");
+    SettingHandle<std::string> hitchhiker("Hitchhiker");
+    bench("SettingHandle<double>/1000", [&] {
+        for (int i = 0; i < 1000; i++) {
+            number_sink = answer.get();
+        }
+    });
+    bench("SettingHandle<std::string>/1000", [&] {
+        for (int i = 0; i < 1000; i++) {
+            text_sink = hitchhiker.get().size();
+        }
+    });
+
+    // Settings page with 100 settings, and a writer copying and publishing them
+    Puara::read_settings_json_internal(settings_document(100));
+    bench("publish_settings/100", [&] {
+        std::lock_guard<std::mutex> lock(Puara::settings_write_mutex);
+        Puara::publish_settings(Puara::copy_settings(), false);
+    });
+    bench("settings_get_handler/100", [&] {
+        puara_host_request(Puara::settings_get_handler, HTTP_GET, "/settings.html");
+    });
+
+    // Form post with 100 settings, and the decoder alone on the same body
+    std::string form;
+    for (int i = 0; i < 100; i++) {
+        form += (i ? "&setting" : "setting") + std::to_string(i) + "=" +
+                ((i % 4 == 0) ? "new+text%21" : std::to_string(i * 0.25));
+    }
+    bench("settings_post_handler/100", [&] {
+        puara_host_request(Puara::settings_post_handler, HTTP_POST, "/settings.html", form);
+    });
+    size_t decoded_fields = 0;
+    bench("formDecoder/100", [&] {
+        Puara::formDecoder decoder;
+        decoder.begin([](void* context, std::string_view, std::string_view) {
+            (*static_cast<size_t*>(context))++;
+        }, &decoded_fields);
+        decoder.feed(form.data(), form.size());
+        decoder.finish();
+    });
+
+    // Serial commands as the interpreter task frames and dispatches them
+    for (const char* command : {"ping", "whatareyou"}) {
+        const std::string line = std::string(command) + "\n";
+        bench(std::string("interpret_serial/") + command, [&] {
+            Puara::frame_serial(line.data(), line.size());
+        });
+    }
+    // Framed transfers of the shipped config and of 100 settings, fed in the
+    // interpreter's 128-byte chunks
+    const std::pair<const char*, std::string> transfers[] = {
+        {"sendconfig", config}, {"sendsettings", settings_document(100)}
+    };
+    for (const auto& transfer : transfers) {
+        char header[64];
+        snprintf(header, sizeof(header), "%s <<<%zu %08x\n", transfer.first, transfer.second.size(),
+                 (unsigned int) Puara::crc32(0, transfer.second.data(), transfer.second.size()));
+        const std::string framed = header + transfer.second + ">>>";
+        bench(std::string("interpret_serial/") + transfer.first, [&] {
+            for (size_t offset = 0; offset < framed.size(); offset += 128) {
+                Puara::frame_serial(framed.data() + offset, std::min<size_t>(128, framed.size() - offset));
+            }
+        });
+    }
+    // and the table lookup alone, for every built-in and a registered command
+    Puara::register_serial_command("blink", [](std::string_view) {});
+    std::vector<std::string_view> names = {"blink"};
+    for (size_t i = 0; i < Puara::serial_commands_count; i++) {
+        names.push_back(Puara::serial_commands[i].name);
+    }
+    for (std::string_view name : names) {
+        bench("find_serial_command/" + std::string(name), [&] {
+            if (Puara::find_serial_command(name) == nullptr) {
+                abort();
+            }
+        });
+    }
+
+    // OSC: encoding a message in place, and sending it to a loopback
+    // receiver that reads it back
+    int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t address_length = sizeof(address);
+    bind(receiver, (struct sockaddr*) &address, sizeof(address));
+    getsockname(receiver, (struct sockaddr*) &address, &address_length);
+    Puara::oscIP1 = "127.0.0.1";
+    Puara::oscPORT1 = ntohs(address.sin_port);
+    Puara::resolve_osc_destinations();
+    PuaraOSC accel("/abc/accel", "ifhd");
+    int sample = 0;
+    bench("PuaraOSC::set/4", [&] {
+        accel.set(0, sample);
+        accel.set(1, 0.5f * sample);
+        accel.set(2, int64_t(sample));
+        accel.set(3, 0.25 * sample++);
+    });
+    char packet[2048];
+    bench("PuaraOSC::send/loopback", [&] {
+        accel.set(0, sample++);
+        if (!accel.send(0) || recv(receiver, packet, sizeof(packet), 0) != (ssize_t) accel.size()) {
+            abort();
+        }
+    });
+
+    // A frame of sensor data, 8 messages of 3 or 4 floats, sent one
+    // datagram per message and then as one bundle. Each entry notes the
+    // datagrams and bytes a frame puts on the wire.
+    std::vector<PuaraOSC> frame;
+    for (const char* address : {"/accel", "/gyro", "/mag", "/euler", "/quat", "/raw/accel", "/raw/gyro", "/raw/mag"}) {
+        frame.emplace_back(address, strcmp(address, "/quat") == 0 ? "ffff" : "fff");
+    }
+    for (bool bundled : {false, true}) {
+        Puara::set_osc_bundling(bundled);
+        auto send_frame = [&] {
+            for (PuaraOSC& message : frame) {
+                message.set(0, 0.5f * sample++);
+                message.send(0);
+            }
+            Puara::flush_osc();
+            while (recv(receiver, packet, sizeof(packet), MSG_DONTWAIT) > 0) {
+            }
+        };
+        Puara::oscStatistics before = Puara::get_osc_statistics();
+        send_frame();
+        Puara::oscStatistics after = Puara::get_osc_statistics();
+        bench(std::string("osc_frame/") + (bundled ? "bundle" : "single"), send_frame, iterations,
+              ", \"packets\": " + std::to_string(after.packets - before.packets) +
+              ", \"wire_bytes\": " + std::to_string(after.bytes - before.bytes));
+    }
+    Puara::set_osc_bundling(false);
+    close(receiver);
+
+    // Incoming OSC through the address trie: a literal address with one
+    // handler, and a pattern that fans out to three
+    int handled = 0;
+    for (const char* address : {"/synth/1/freq", "/synth/2/freq", "/synth/10/freq", "/synth/1/gain", "/fx"}) {
+        Puara::register_osc_handler(address, [](const PuaraOSCMessage& message, void* context) {
+            (*static_cast<int*>(context))++;
+        }, &handled);
+    }
+    for (const char* address : {"/synth/1/freq", "/synth/*/freq"}) {
+        std::string incoming(address);
+        incoming.resize((incoming.size() + 4) & ~static_cast<size_t>(3), '\0');
+        incoming += std::string(",f\0\0\x3f\x80\0\0", 8);
+        std::vector<char> buffer(incoming.begin(), incoming.end());
+        bench(std::string("dispatch_osc_packet") + address, [&] {
+            std::copy(incoming.begin(), incoming.end(), buffer.begin());
+            Puara::dispatch_osc_packet(buffer.data(), buffer.size(), 0);
+        });
+    }
+
+    // A bundle writing eight of 100 settings, each to a new value every time
+    Puara::read_settings_json_internal(settings_document(100));
+    {
+        std::lock_guard<std::mutex> lock(Puara::osc_nodes_mutex);
+        Puara::register_osc_settings();
+    }
+    std::string settings_bundle("#bundle\0\0\0\0\0\0\0\0\1", 16);
+    std::vector<size_t> value_offsets;
+    for (int i : {1, 2, 3, 5, 6, 7, 9, 10}) {
+        std::string element = "/settings/setting" + std::to_string(i);
+        element.resize((element.size() + 4) & ~static_cast<size_t>(3), '\0');
+        element += std::string(",d\0\0\x3f\xf0\0\0\0\0\0\0", 12);
+        uint32_t size = htonl(element.size());
+        settings_bundle.append(reinterpret_cast<const char*>(&size), 4);
+        value_offsets.push_back(settings_bundle.size() + element.size() - 1);
+        settings_bundle += element;
+    }
+    std::vector<char> bundle_buffer(settings_bundle.begin(), settings_bundle.end());
+    unsigned char counter = 0;
+    bench("dispatch_osc_packet/settings bundle of 8", [&] {
+        std::copy(settings_bundle.begin(), settings_bundle.end(), bundle_buffer.begin());
+        counter++;
+        for (size_t offset : value_offsets) {
+            bundle_buffer[offset] = counter;
+        }
+        std::lock_guard<std::mutex> lock(Puara::osc_nodes_mutex);
+        Puara::dispatch_osc_packet(bundle_buffer.data(), bundle_buffer.size(), 0);
+    });
+
+    std::string command = "rm -rf " + std::string(directory);
+    (void) system(command.c_str());
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        iterations = std::max(atol(argv[1]), 1L);
+    }
+    // the results go to the original stdout, the module's messages nowhere
+    FILE* output = fdopen(dup(fileno(stdout)), "w");
+    (void) freopen("/dev/null", "w", stdout);
+    PuaraTest::run();
+    fprintf(output, "{\n  \"iterations\": %zu,\n  \"benchmarks\": [\n%s\n  ]\n}\n", iterations, results.c_str());
+    fclose(output);
+    return 0;
+}
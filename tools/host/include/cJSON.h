@@ -0,0 +1,6 @@
+// Host stand-in for cJSON.h: puara.cpp has its own JSON reader and only
+// includes the header
+#ifndef PUARA_HOST_CJSON_H
+#define PUARA_HOST_CJSON_H
+
+#endif
@@ -0,0 +1,9 @@
+// Host stand-in for ESP-IDF's driver/usb_serial_jtag.h (ESP32-S2/S3 only,
+// so never compiled by the host build)
+#ifndef PUARA_HOST_DRIVER_USB_SERIAL_JTAG_H
+#define PUARA_HOST_DRIVER_USB_SERIAL_JTAG_H
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#endif
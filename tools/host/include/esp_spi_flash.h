@@ -0,0 +1,7 @@
+// Host stand-in for ESP-IDF's esp_spi_flash.h (nothing used by puara.cpp)
+#ifndef PUARA_HOST_ESP_SPI_FLASH_H
+#define PUARA_HOST_ESP_SPI_FLASH_H
+
+#include "esp_err.h"
+
+#endif
@@ -0,0 +1,21 @@
+// Host stand-in for ESP-IDF's esp_spiffs.h. A partition is a directory of
+// the host: files opened under base_path are redirected there, see
+// puara_host_spiffs_directory()
+#ifndef PUARA_HOST_ESP_SPIFFS_H
+#define PUARA_HOST_ESP_SPIFFS_H
+
+#include "esp_err.h"
+
+typedef struct {
+    const char* base_path;
+    const char* partition_label;
+    size_t max_files;
+    bool format_if_mount_failed;
+} esp_vfs_spiffs_conf_t;
+
+esp_err_t esp_vfs_spiffs_register(const esp_vfs_spiffs_conf_t* conf);
+esp_err_t esp_vfs_spiffs_unregister(const char* partition_label);
+bool esp_spiffs_mounted(const char* partition_label);
+esp_err_t esp_spiffs_info(const char* partition_label, size_t* total_bytes, size_t* used_bytes);
+
+#endif
@@ -0,0 +1,11 @@
+// Host stand-in for ESP-IDF's esp_system.h
+#ifndef PUARA_HOST_ESP_SYSTEM_H
+#define PUARA_HOST_ESP_SYSTEM_H
+
+#include "esp_err.h"
+
+// Calls the hook set with puara_host_on_restart(), or exits the process
+void esp_restart(void);
+uint32_t esp_random(void);
+
+#endif
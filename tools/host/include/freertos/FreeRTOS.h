@@ -0,0 +1,23 @@
+// Host stand-in for FreeRTOS.h: one tick is one millisecond
+#ifndef PUARA_HOST_FREERTOS_H
+#define PUARA_HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY ((TickType_t) 0xffffffffUL)
+#define portTICK_PERIOD_MS ((TickType_t) 1)
+#define portTICK_RATE_MS portTICK_PERIOD_MS
+#define pdMS_TO_TICKS(ms) ((TickType_t) (ms))
+#define configMAX_PRIORITIES 25
+
+#endif
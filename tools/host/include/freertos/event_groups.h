@@ -0,0 +1,20 @@
+// Host stand-in for FreeRTOS event_groups.h
+#ifndef PUARA_HOST_FREERTOS_EVENT_GROUPS_H
+#define PUARA_HOST_FREERTOS_EVENT_GROUPS_H
+
+#include "FreeRTOS.h"
+
+typedef struct hostEventGroup* EventGroupHandle_t;
+typedef uint32_t EventBits_t;
+
+#define BIT0 0x00000001
+#define BIT1 0x00000002
+
+EventGroupHandle_t xEventGroupCreate(void);
+void vEventGroupDelete(EventGroupHandle_t group);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks_to_wait);
+
+#endif
@@ -0,0 +1,28 @@
+// Host stand-in for FreeRTOS task.h. Tasks are detached threads; priorities,
+// stack sizes and core affinity are accepted and ignored.
+#ifndef PUARA_HOST_FREERTOS_TASK_H
+#define PUARA_HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef struct hostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void* parameters);
+
+#define tskIDLE_PRIORITY ((UBaseType_t) 0)
+#define tskNO_AFFINITY 0x7fffffff
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stack_depth,
+                       void* parameters, UBaseType_t priority, TaskHandle_t* created_task);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stack_depth,
+                                   void* parameters, UBaseType_t priority, TaskHandle_t* created_task,
+                                   BaseType_t core_id);
+// vTaskDelete(NULL) ends the calling task
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+// Threads that were not created through xTaskCreate get a handle on first use
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait);
+
+#endif
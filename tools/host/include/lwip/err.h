@@ -0,0 +1,5 @@
+// Host stand-in for lwIP's err.h (nothing used by puara.cpp)
+#ifndef PUARA_HOST_LWIP_ERR_H
+#define PUARA_HOST_LWIP_ERR_H
+
+#endif
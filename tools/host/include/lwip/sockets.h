@@ -0,0 +1,14 @@
+// Host stand-in for lwIP's sockets.h: the BSD socket API of the host
+#ifndef PUARA_HOST_LWIP_SOCKETS_H
+#define PUARA_HOST_LWIP_SOCKETS_H
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+
+#endif
@@ -0,0 +1,5 @@
+// Host stand-in for lwIP's sys.h (nothing used by puara.cpp)
+#ifndef PUARA_HOST_LWIP_SYS_H
+#define PUARA_HOST_LWIP_SYS_H
+
+#endif
@@ -0,0 +1,11 @@
+// Host stand-in for ESP-IDF's mdns.h: names are accepted and not announced
+#ifndef PUARA_HOST_MDNS_H
+#define PUARA_HOST_MDNS_H
+
+#include "esp_err.h"
+
+esp_err_t mdns_init(void);
+esp_err_t mdns_hostname_set(const char* hostname);
+esp_err_t mdns_instance_name_set(const char* instance_name);
+
+#endif
@@ -0,0 +1,25 @@
+// Host stand-in for ESP-IDF's nvs.h: namespaces live in memory for the
+// lifetime of the process, see puara_host_nvs_erase()
+#ifndef PUARA_HOST_NVS_H
+#define PUARA_HOST_NVS_H
+
+#include "esp_err.h"
+
+typedef uint32_t nvs_handle_t;
+
+typedef enum {
+    NVS_READONLY,
+    NVS_READWRITE,
+} nvs_open_mode_t;
+
+esp_err_t nvs_open(const char* namespace_name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle);
+void nvs_close(nvs_handle_t handle);
+esp_err_t nvs_commit(nvs_handle_t handle);
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key);
+esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value);
+// With out_value NULL, length is set to the size needed including the terminator
+esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length);
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char* key, uint32_t value);
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char* key, uint32_t* out_value);
+
+#endif
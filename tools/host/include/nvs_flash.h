@@ -0,0 +1,10 @@
+// Host stand-in for ESP-IDF's nvs_flash.h
+#ifndef PUARA_HOST_NVS_FLASH_H
+#define PUARA_HOST_NVS_FLASH_H
+
+#include "nvs.h"
+
+esp_err_t nvs_flash_init(void);
+esp_err_t nvs_flash_erase(void);
+
+#endif
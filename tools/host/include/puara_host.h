@@ -0,0 +1,44 @@
+// Controls for the ESP-IDF stand-ins of the host build, for tests and
+// benchmarks. Nothing here exists on the device.
+#ifndef PUARA_HOST_H
+#define PUARA_HOST_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include "esp_http_server.h"
+#include "driver/uart.h"
+
+// Files under the SPIFFS base path ("/spiffs") are kept in this directory.
+// Defaults to $PUARA_HOST_SPIFFS, or "spiffs" in the working directory.
+void puara_host_spiffs_directory(const std::string& directory);
+// Where a device path such as "/spiffs/config.json" lives on the host
+std::string puara_host_spiffs_path(const std::string& path);
+
+// Drops every NVS namespace, as nvs_flash_erase() does
+void puara_host_nvs_erase();
+
+// esp_restart() calls hook instead of exiting the process
+void puara_host_on_restart(void (*hook)());
+
+// Port of the loopback server started by httpd_start(), 0 if not running
+int puara_host_http_port();
+
+struct puaraHostResponse {
+    esp_err_t result;   // what the handler returned
+    std::string status; // "200 OK" unless set
+    std::string content_type;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    int chunks;         // httpd_resp_send_chunk() calls, including the last
+};
+
+// Calls handler the way the httpd task would. httpd_req_recv() hands out
+// the body at most chunk bytes at a time (0 for no limit), so tests can
+// place the chunk boundaries.
+puaraHostResponse puara_host_request(esp_err_t (*handler)(httpd_req_t* r), int method, const std::string& uri,
+                                     const std::string& body = std::string(), size_t chunk = 0,
+                                     const std::vector<std::pair<std::string, std::string>>& headers = {},
+                                     void* user_ctx = nullptr);
+
+#endif
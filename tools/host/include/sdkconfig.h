@@ -0,0 +1,8 @@
+// Host stand-in for the generated sdkconfig.h: the host build is an ESP32
+// without USB serial
+#ifndef PUARA_HOST_SDKCONFIG_H
+#define PUARA_HOST_SDKCONFIG_H
+
+#define CONFIG_IDF_TARGET_ESP32 1
+
+#endif
@@ -0,0 +1,5 @@
+// Host stand-in for ESP-IDF's soc/uart_struct.h (nothing used by puara.cpp)
+#ifndef PUARA_HOST_SOC_UART_STRUCT_H
+#define PUARA_HOST_SOC_UART_STRUCT_H
+
+#endif
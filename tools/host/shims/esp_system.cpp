@@ -0,0 +1,324 @@
+// esp_system, esp_timer, the default event loop, Wi-Fi, netif and mDNS
+
+#include <esp_err.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <esp_event.h>
+#include <esp_wifi.h>
+#include <mdns.h>
+#include <puara_host.h>
+#include <arpa/inet.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_NVS_NOT_FOUND: return "ESP_ERR_NVS_NOT_FOUND";
+        case ESP_ERR_NVS_READ_ONLY: return "ESP_ERR_NVS_READ_ONLY";
+        case ESP_ERR_NVS_INVALID_LENGTH: return "ESP_ERR_NVS_INVALID_LENGTH";
+        case ESP_ERR_NVS_NO_FREE_PAGES: return "ESP_ERR_NVS_NO_FREE_PAGES";
+        case ESP_ERR_NVS_NEW_VERSION_FOUND: return "ESP_ERR_NVS_NEW_VERSION_FOUND";
+        default: return "UNKNOWN ERROR";
+    }
+}
+
+static void (*restart_hook)() = nullptr;
+
+void puara_host_on_restart(void (*hook)()) {
+    restart_hook = hook;
+}
+
+void esp_restart(void) {
+    if (restart_hook != nullptr) {
+        restart_hook();
+        return;
+    }
+    std::cout << "esp_restart: exiting" << std::endl;
+    std::exit(0);
+}
+
+uint32_t esp_random(void) {
+    static std::mutex mutex;
+    static std::mt19937 generator{std::random_device{}()};
+    std::lock_guard<std::mutex> lock(mutex);
+    return generator();
+}
+
+// esp_timer: each timer has a thread that sleeps until it is due
+
+static const auto boot_time = std::chrono::steady_clock::now();
+
+int64_t esp_timer_get_time(void) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - boot_time).count();
+}
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void* arg;
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool armed = false;
+    bool deleted = false;
+    std::chrono::steady_clock::time_point due;
+    std::thread worker;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!deleted) {
+            if (!armed) {
+                changed.wait(lock);
+            } else if (changed.wait_until(lock, due) == std::cv_status::timeout && armed &&
+                       std::chrono::steady_clock::now() >= due) {
+                armed = false;
+                lock.unlock();
+                callback(arg);
+                lock.lock();
+            }
+        }
+    }
+};
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle) {
+    if (create_args == nullptr || create_args->callback == nullptr || out_handle == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_timer_handle_t timer = new esp_timer;
+    timer->callback = create_args->callback;
+    timer->arg = create_args->arg;
+    timer->worker = std::thread(&esp_timer::run, timer);
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->armed = true;
+    timer->due = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout_us);
+    timer->changed.notify_all();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    std::lock_guard<std::mutex> lock(timer->mutex);
+    if (!timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->armed = false;
+    timer->changed.notify_all();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    {
+        std::lock_guard<std::mutex> lock(timer->mutex);
+        if (timer->armed) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        timer->deleted = true;
+        timer->changed.notify_all();
+    }
+    timer->worker.join();
+    delete timer;
+    return ESP_OK;
+}
+
+// The default event loop: one thread delivers posted events in order
+
+esp_event_base_t const WIFI_EVENT = "WIFI_EVENT";
+esp_event_base_t const IP_EVENT = "IP_EVENT";
+
+struct eventHandler {
+    esp_event_base_t base;
+    int32_t id;
+    esp_event_handler_t handler;
+    void* arg;
+    int instance;
+};
+
+struct postedEvent {
+    esp_event_base_t base;
+    int32_t id;
+    std::vector<char> data;
+};
+
+static std::mutex event_mutex;
+static std::condition_variable event_posted;
+static std::vector<eventHandler> event_handlers;
+static std::deque<postedEvent> event_queue;
+static int event_instances = 0;
+static bool event_loop_running = false;
+
+static void run_event_loop() {
+    std::unique_lock<std::mutex> lock(event_mutex);
+    while (true) {
+        event_posted.wait(lock, [] { return !event_queue.empty(); });
+        postedEvent event = std::move(event_queue.front());
+        event_queue.pop_front();
+        std::vector<eventHandler> handlers = event_handlers;
+        lock.unlock();
+        for (const eventHandler& entry : handlers) {
+            if (entry.base == event.base && (entry.id == ESP_EVENT_ANY_ID || entry.id == event.id)) {
+                entry.handler(entry.arg, event.base, event.id, event.data.empty() ? nullptr : event.data.data());
+            }
+        }
+        lock.lock();
+    }
+}
+
+esp_err_t esp_event_loop_create_default(void) {
+    std::lock_guard<std::mutex> lock(event_mutex);
+    if (event_loop_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    event_loop_running = true;
+    std::thread(run_event_loop).detach();
+    return ESP_OK;
+}
+
+esp_err_t esp_event_handler_instance_register(esp_event_base_t event_base, int32_t event_id,
+                                              esp_event_handler_t event_handler, void* event_handler_arg,
+                                              esp_event_handler_instance_t* instance) {
+    std::lock_guard<std::mutex> lock(event_mutex);
+    int id = ++event_instances;
+    event_handlers.push_back({event_base, event_id, event_handler, event_handler_arg, id});
+    if (instance != nullptr) {
+        *instance = reinterpret_cast<esp_event_handler_instance_t>(static_cast<intptr_t>(id));
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_event_handler_instance_unregister(esp_event_base_t event_base, int32_t event_id,
+                                                esp_event_handler_instance_t instance) {
+    std::lock_guard<std::mutex> lock(event_mutex);
+    int id = static_cast<int>(reinterpret_cast<intptr_t>(instance));
+    for (auto it = event_handlers.begin(); it != event_handlers.end(); ++it) {
+        if (it->instance == id) {
+            event_handlers.erase(it);
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id,
+                         const void* event_data, size_t event_data_size, uint32_t ticks_to_wait) {
+    std::lock_guard<std::mutex> lock(event_mutex);
+    if (!event_loop_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const char* data = static_cast<const char*>(event_data);
+    event_queue.push_back({event_base, event_id, std::vector<char>(data, data + (data ? event_data_size : 0))});
+    event_posted.notify_all();
+    return ESP_OK;
+}
+
+// Network interfaces: both the station and the access point are 127.0.0.1
+
+struct esp_netif_obj {
+    int unused;
+};
+
+static esp_netif_obj netif_sta, netif_ap;
+
+esp_err_t esp_netif_init(void) {
+    return ESP_OK;
+}
+
+esp_netif_t* esp_netif_create_default_wifi_sta(void) {
+    return &netif_sta;
+}
+
+esp_netif_t* esp_netif_create_default_wifi_ap(void) {
+    return &netif_ap;
+}
+
+esp_err_t esp_netif_get_ip_info(esp_netif_t* esp_netif, esp_netif_ip_info_t* ip_info) {
+    memset(ip_info, 0, sizeof(*ip_info));
+    ip_info->ip.addr = htonl(INADDR_LOOPBACK);
+    ip_info->netmask.addr = htonl(0xff000000);
+    return ESP_OK;
+}
+
+esp_err_t tcpip_adapter_set_hostname(tcpip_adapter_if_t tcpip_if, const char* hostname) {
+    return ESP_OK;
+}
+
+// Wi-Fi: the station "connects" as soon as it is asked to
+
+esp_err_t esp_wifi_init(const wifi_init_config_t* config) {
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode) {
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_config(wifi_interface_t interface, wifi_config_t* conf) {
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_start(void) {
+    return esp_event_post(WIFI_EVENT, WIFI_EVENT_STA_START, nullptr, 0, portMAX_DELAY);
+}
+
+esp_err_t esp_wifi_connect(void) {
+    ip_event_got_ip_t event;
+    memset(&event, 0, sizeof(event));
+    event.esp_netif = &netif_sta;
+    esp_netif_get_ip_info(&netif_sta, &event.ip_info);
+    event.ip_changed = true;
+    return esp_event_post(IP_EVENT, IP_EVENT_STA_GOT_IP, &event, sizeof(event), portMAX_DELAY);
+}
+
+esp_err_t esp_wifi_get_mac(wifi_interface_t ifx, uint8_t mac[6]) {
+    // locally administered, one apart like on the device
+    const uint8_t host_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, static_cast<uint8_t>(ifx == WIFI_IF_AP ? 0x01 : 0x00)};
+    memcpy(mac, host_mac, sizeof(host_mac));
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t* config, bool block) {
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_get_ap_num(uint16_t* number) {
+    *number = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t* number, wifi_ap_record_t* ap_records) {
+    *number = 0;
+    return ESP_OK;
+}
+
+esp_err_t mdns_init(void) {
+    return ESP_OK;
+}
+
+esp_err_t mdns_hostname_set(const char* hostname) {
+    return ESP_OK;
+}
+
+esp_err_t mdns_instance_name_set(const char* instance_name) {
+    return ESP_OK;
+}
@@ -0,0 +1,348 @@
+// esp_http_server on the host. Handlers see the same httpd_req_t calls as
+// on the device; the request body is read from the connection as the
+// handler asks for it (or served from memory by puara_host_request()), and
+// the response is collected, then written out by the loopback server or
+// returned by puara_host_request().
+
+#include <esp_http_server.h>
+#include <puara_host.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+struct hostRequest {
+    httpd_req_t req = {};
+    std::string body;
+    size_t position;
+    size_t chunk;
+    int socket = -1; // the rest of the body is read from here
+    size_t unread = 0;
+    std::vector<std::pair<std::string, std::string>> headers;
+    puaraHostResponse response;
+};
+
+static hostRequest* host_request(httpd_req_t* r) {
+    return static_cast<hostRequest*>(r->aux);
+}
+
+static void begin_request(hostRequest& request, int method, const std::string& uri, void* user_ctx) {
+    memset(static_cast<void*>(&request.req), 0, sizeof(request.req)); // uri is const, so no assignment
+    request.req.method = method;
+    // uri is const in httpd_req_t, as the server fills it in
+    strncpy(const_cast<char*>(request.req.uri), uri.c_str(), HTTPD_MAX_URI_LEN);
+    request.req.content_len = request.body.size();
+    request.req.aux = &request;
+    request.req.user_ctx = user_ctx;
+    request.position = 0;
+    request.response.result = ESP_OK;
+    request.response.status = "200 OK";
+    request.response.content_type = "text/html";
+    request.response.chunks = 0;
+}
+
+puaraHostResponse puara_host_request(esp_err_t (*handler)(httpd_req_t* r), int method, const std::string& uri,
+                                     const std::string& body, size_t chunk,
+                                     const std::vector<std::pair<std::string, std::string>>& headers,
+                                     void* user_ctx) {
+    hostRequest request;
+    request.body = body;
+    request.chunk = chunk;
+    request.headers = headers;
+    begin_request(request, method, uri, user_ctx);
+    request.response.result = handler(&request.req);
+    return request.response;
+}
+
+int httpd_req_recv(httpd_req_t* r, char* buf, size_t buf_len) {
+    hostRequest* request = host_request(r);
+    if (request->position == request->body.size() && request->unread > 0) {
+        ssize_t received = recv(request->socket, buf, std::min(buf_len, request->unread), 0);
+        if (received <= 0) {
+            return HTTPD_SOCK_ERR_FAIL;
+        }
+        request->unread -= received;
+        return static_cast<int>(received);
+    }
+    size_t length = std::min(buf_len, request->body.size() - request->position);
+    if (request->chunk != 0) {
+        length = std::min(length, request->chunk);
+    }
+    memcpy(buf, request->body.data() + request->position, length);
+    request->position += length;
+    return static_cast<int>(length);
+}
+
+static const std::string* find_header(httpd_req_t* r, const char* field) {
+    for (const auto& header : host_request(r)->headers) {
+        if (strcasecmp(header.first.c_str(), field) == 0) {
+            return &header.second;
+        }
+    }
+    return nullptr;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t* r, const char* field) {
+    const std::string* value = find_header(r, field);
+    return value ? value->size() : 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* r, const char* field, char* val, size_t val_size) {
+    const std::string* value = find_header(r, field);
+    if (value == nullptr) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (val_size == 0) {
+        return ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+    size_t length = std::min(value->size(), val_size - 1);
+    memcpy(val, value->data(), length);
+    val[length] = '\0';
+    return length < value->size() ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t* r, const char* status) {
+    host_request(r)->response.status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type) {
+    host_request(r)->response.content_type = type;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t* r, const char* field, const char* value) {
+    host_request(r)->response.headers.emplace_back(field, value);
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len) {
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    host_request(r)->response.body.assign(buf ? buf : "", buf ? buf_len : 0);
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len) {
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    puaraHostResponse& response = host_request(r)->response;
+    response.chunks++;
+    if (buf != nullptr) {
+        response.body.append(buf, buf_len);
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_sendstr(httpd_req_t* r, const char* str) {
+    return httpd_resp_send(r, str, HTTPD_RESP_USE_STRLEN);
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* usr_msg) {
+    static const char* const statuses[] = {
+        "500 Internal Server Error", "501 Method Not Implemented", "505 Version Not Supported",
+        "400 Bad Request", "401 Unauthorized", "403 Forbidden", "404 Not Found",
+        "405 Method Not Allowed", "408 Request Timeout", "411 Length Required",
+        "414 URI Too Long", "431 Request Header Fields Too Large"
+    };
+    const char* status = statuses[error];
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, "text/html");
+    return httpd_resp_send(req, usr_msg ? usr_msg : strchr(status, ' ') + 1, HTTPD_RESP_USE_STRLEN);
+}
+
+// The loopback server: one thread, one request per connection
+
+struct hostServer {
+    int listener;
+    int port;
+    std::mutex mutex;
+    std::vector<httpd_uri_t> handlers;
+    std::atomic<bool> running;
+    std::thread thread;
+};
+
+static std::atomic<int> server_port{0};
+
+static int parse_method(const std::string& name) {
+    static const std::pair<const char*, int> methods[] = {
+        {"DELETE", HTTP_DELETE}, {"GET", HTTP_GET}, {"HEAD", HTTP_HEAD},
+        {"POST", HTTP_POST}, {"PUT", HTTP_PUT}, {"PATCH", HTTP_PATCH}
+    };
+    for (const auto& method : methods) {
+        if (name == method.first) {
+            return method.second;
+        }
+    }
+    return -1;
+}
+
+static bool send_all(int socket, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t length = send(socket, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (length <= 0) {
+            return false;
+        }
+        sent += length;
+    }
+    return true;
+}
+
+static void serve_connection(hostServer* server, int socket) {
+    const size_t max_head = 16384;
+    const size_t max_body = 1 << 20;
+    std::string data;
+    size_t head_end;
+    char buffer[4096];
+    while ((head_end = data.find("\r\n\r\n")) == std::string::npos) {
+        ssize_t length = recv(socket, buffer, sizeof(buffer), 0);
+        if (length <= 0 || data.size() > max_head) {
+            return;
+        }
+        data.append(buffer, length);
+    }
+
+    hostRequest request;
+    std::istringstream head(data.substr(0, head_end));
+    std::string line, method_name, uri;
+    std::getline(head, line);
+    std::istringstream(line) >> method_name >> uri;
+    size_t content_length = 0;
+    while (std::getline(head, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        size_t start = line.find_first_not_of(' ', colon + 1);
+        std::string value = start == std::string::npos ? std::string() : line.substr(start);
+        request.headers.emplace_back(line.substr(0, colon), value);
+        if (strcasecmp(request.headers.back().first.c_str(), "Content-Length") == 0) {
+            content_length = strtoul(value.c_str(), nullptr, 10);
+        }
+    }
+    if (content_length > max_body) {
+        return;
+    }
+    request.body = data.substr(head_end + 4, content_length);
+    request.socket = socket;
+    request.unread = content_length - request.body.size();
+    request.chunk = 0;
+
+    int method = parse_method(method_name);
+    std::string path = uri.substr(0, uri.find('?'));
+    httpd_uri_t handler = {};
+    {
+        std::lock_guard<std::mutex> lock(server->mutex);
+        for (const httpd_uri_t& entry : server->handlers) {
+            if (path == entry.uri && method == entry.method) {
+                handler = entry;
+                break;
+            }
+        }
+    }
+    begin_request(request, method, uri, handler.user_ctx);
+    request.req.content_len = content_length;
+    request.req.handle = server;
+    if (handler.handler == nullptr) {
+        httpd_resp_send_err(&request.req, HTTPD_404_NOT_FOUND, "Nothing matches the given URI");
+    } else if (handler.handler(&request.req) != ESP_OK && request.response.body.empty()) {
+        // the device closes the connection without a response
+        return;
+    }
+
+    const puaraHostResponse& response = request.response;
+    std::string reply = "HTTP/1.1 " + response.status + "\r\nContent-Type: " + response.content_type + "\r\n";
+    for (const auto& header : response.headers) {
+        reply += header.first + ": " + header.second + "\r\n";
+    }
+    reply += "Content-Length: " + std::to_string(response.body.size()) + "\r\nConnection: close\r\n\r\n";
+    if (method != HTTP_HEAD) {
+        reply += response.body;
+    }
+    send_all(socket, reply);
+}
+
+static void run_server(hostServer* server) {
+    while (server->running) {
+        int connection = accept(server->listener, nullptr, nullptr);
+        if (connection < 0) {
+            continue;
+        }
+        serve_connection(server, connection);
+        close(connection);
+    }
+}
+
+esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config) {
+    int port = config->server_port;
+    if (const char* override_port = getenv("PUARA_HOST_HTTP_PORT")) {
+        port = atoi(override_port);
+    }
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    socklen_t address_length = sizeof(address);
+    if (listener < 0 || bind(listener, (struct sockaddr*) &address, sizeof(address)) != 0 ||
+        listen(listener, config->backlog_conn) != 0 ||
+        getsockname(listener, (struct sockaddr*) &address, &address_length) != 0) {
+        std::cout << "httpd: Cannot listen on 127.0.0.1:" << port << " (errno " << errno << ")" << std::endl;
+        if (listener >= 0) {
+            close(listener);
+        }
+        return ESP_FAIL;
+    }
+    hostServer* server = new hostServer;
+    server->listener = listener;
+    server->port = ntohs(address.sin_port);
+    server->running = true;
+    server->thread = std::thread(run_server, server);
+    server_port = server->port;
+    std::cout << "httpd: Listening on http://127.0.0.1:" << server->port << std::endl;
+    *handle = server;
+    return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle) {
+    hostServer* server = static_cast<hostServer*>(handle);
+    if (server == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    server->running = false;
+    shutdown(server->listener, SHUT_RDWR);
+    server->thread.join();
+    close(server->listener);
+    server_port = 0;
+    delete server;
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler) {
+    hostServer* server = static_cast<hostServer*>(handle);
+    std::lock_guard<std::mutex> lock(server->mutex);
+    server->handlers.push_back(*uri_handler);
+    return ESP_OK;
+}
+
+int puara_host_http_port() {
+    return server_port;
+}
@@ -0,0 +1,153 @@
+// NVS kept in memory: namespaces of string and u32 entries
+
+#include <nvs.h>
+#include <nvs_flash.h>
+#include <puara_host.h>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+struct nvsEntry {
+    bool is_text;
+    std::string text;
+    uint32_t number;
+};
+
+struct nvsOpenHandle {
+    std::string name;
+    nvs_open_mode_t mode;
+};
+
+static std::mutex nvs_mutex;
+static std::map<std::string, std::map<std::string, nvsEntry>> nvs_namespaces;
+static std::map<nvs_handle_t, nvsOpenHandle> nvs_handles;
+static nvs_handle_t nvs_next_handle = 1;
+static bool nvs_ready = false;
+
+void puara_host_nvs_erase() {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    nvs_namespaces.clear();
+}
+
+esp_err_t nvs_flash_init(void) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    nvs_ready = true;
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void) {
+    puara_host_nvs_erase();
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char* namespace_name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    if (!nvs_ready) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (open_mode == NVS_READONLY && nvs_namespaces.find(namespace_name) == nvs_namespaces.end()) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    nvs_namespaces[namespace_name];
+    *out_handle = nvs_next_handle++;
+    nvs_handles[*out_handle] = {namespace_name, open_mode};
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    nvs_handles.erase(handle);
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    return nvs_handles.count(handle) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+// Expects nvs_mutex to be held
+static std::map<std::string, nvsEntry>* nvs_find(nvs_handle_t handle, bool write, esp_err_t& err) {
+    auto open = nvs_handles.find(handle);
+    if (open == nvs_handles.end()) {
+        err = ESP_ERR_INVALID_ARG;
+        return nullptr;
+    }
+    if (write && open->second.mode == NVS_READONLY) {
+        err = ESP_ERR_NVS_READ_ONLY;
+        return nullptr;
+    }
+    err = ESP_OK;
+    return &nvs_namespaces[open->second.name];
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    esp_err_t err;
+    auto* entries = nvs_find(handle, true, err);
+    if (entries == nullptr) {
+        return err;
+    }
+    return entries->erase(key) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    esp_err_t err;
+    auto* entries = nvs_find(handle, true, err);
+    if (entries == nullptr) {
+        return err;
+    }
+    (*entries)[key] = {true, value, 0};
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    esp_err_t err;
+    auto* entries = nvs_find(handle, false, err);
+    if (entries == nullptr) {
+        return err;
+    }
+    auto entry = entries->find(key);
+    if (entry == entries->end() || !entry->second.is_text) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    size_t needed = entry->second.text.size() + 1;
+    if (out_value == nullptr) {
+        *length = needed;
+        return ESP_OK;
+    }
+    if (*length < needed) {
+        *length = needed;
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    memcpy(out_value, entry->second.text.c_str(), needed);
+    *length = needed;
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char* key, uint32_t value) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    esp_err_t err;
+    auto* entries = nvs_find(handle, true, err);
+    if (entries == nullptr) {
+        return err;
+    }
+    (*entries)[key] = {false, std::string(), value};
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char* key, uint32_t* out_value) {
+    std::lock_guard<std::mutex> lock(nvs_mutex);
+    esp_err_t err;
+    auto* entries = nvs_find(handle, false, err);
+    if (entries == nullptr) {
+        return err;
+    }
+    auto entry = entries->find(key);
+    if (entry == entries->end() || entry->second.is_text) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    *out_value = entry->second.number;
+    return ESP_OK;
+}
@@ -0,0 +1,109 @@
+// SPIFFS on a host directory. puara.cpp opens "/spiffs/..." paths with
+// fopen(), std::ifstream, rename() and remove(); those functions are
+// defined here so the executable's copies take precedence over the C
+// library's (for libstdc++ too), and device paths are redirected before
+// calling the real ones.
+
+#include <esp_spiffs.h>
+#include <puara_host.h>
+#include <dlfcn.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+
+static std::mutex spiffs_mutex;
+static std::string spiffs_base = "/spiffs";
+static std::string spiffs_directory;
+static bool spiffs_registered = false;
+
+void puara_host_spiffs_directory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(spiffs_mutex);
+    spiffs_directory = directory;
+}
+
+std::string puara_host_spiffs_path(const std::string& path) {
+    std::lock_guard<std::mutex> lock(spiffs_mutex);
+    if (path.compare(0, spiffs_base.size() + 1, spiffs_base + "/") != 0) {
+        return path;
+    }
+    if (spiffs_directory.empty()) {
+        const char* directory = getenv("PUARA_HOST_SPIFFS");
+        spiffs_directory = directory ? directory : "spiffs";
+    }
+    return spiffs_directory + path.substr(spiffs_base.size());
+}
+
+esp_err_t esp_vfs_spiffs_register(const esp_vfs_spiffs_conf_t* conf) {
+    std::lock_guard<std::mutex> lock(spiffs_mutex);
+    if (spiffs_registered) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    spiffs_base = conf->base_path;
+    spiffs_registered = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_spiffs_unregister(const char* partition_label) {
+    std::lock_guard<std::mutex> lock(spiffs_mutex);
+    if (!spiffs_registered) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    spiffs_registered = false;
+    return ESP_OK;
+}
+
+bool esp_spiffs_mounted(const char* partition_label) {
+    std::lock_guard<std::mutex> lock(spiffs_mutex);
+    return spiffs_registered;
+}
+
+esp_err_t esp_spiffs_info(const char* partition_label, size_t* total_bytes, size_t* used_bytes) {
+    // a 1 MB partition, of which the files in the directory are used
+    std::string directory = puara_host_spiffs_path(spiffs_base + "/");
+    *total_bytes = 1 << 20;
+    *used_bytes = 0;
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        return ESP_OK;
+    }
+    while (struct dirent* entry = readdir(dir)) {
+        struct stat info;
+        if (stat((directory + entry->d_name).c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+            *used_bytes += info.st_size;
+        }
+    }
+    closedir(dir);
+    return ESP_OK;
+}
+
+template <typename Function>
+static Function real_function(const char* name) {
+    return reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+}
+
+extern "C" {
+
+FILE* fopen(const char* path, const char* mode) {
+    static auto real = real_function<FILE* (*)(const char*, const char*)>("fopen");
+    return real(puara_host_spiffs_path(path).c_str(), mode);
+}
+
+FILE* fopen64(const char* path, const char* mode) {
+    static auto real = real_function<FILE* (*)(const char*, const char*)>("fopen64");
+    return real(puara_host_spiffs_path(path).c_str(), mode);
+}
+
+int rename(const char* old_path, const char* new_path) {
+    static auto real = real_function<int (*)(const char*, const char*)>("rename");
+    return real(puara_host_spiffs_path(old_path).c_str(), puara_host_spiffs_path(new_path).c_str());
+}
+
+int remove(const char* path) {
+    static auto real = real_function<int (*)(const char*)>("remove");
+    return real(puara_host_spiffs_path(path).c_str());
+}
+
+}
@@ -0,0 +1,104 @@
+// UART ports as pseudo-terminals. What a terminal writes to the slave side
+// is read by uart_read_bytes(); the module's replies still go to stdout.
+
+#include <driver/uart.h>
+#include <puara_host.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+struct hostUart {
+    int master;
+    int slave; // kept open so reads do not fail while no terminal is attached
+    std::string path;
+};
+
+static std::mutex uart_mutex;
+static std::map<uart_port_t, hostUart> uart_ports;
+
+static int uart_master(uart_port_t uart_num) {
+    std::lock_guard<std::mutex> lock(uart_mutex);
+    auto port = uart_ports.find(uart_num);
+    return port == uart_ports.end() ? -1 : port->second.master;
+}
+
+esp_err_t uart_driver_install(uart_port_t uart_num, int rx_buffer_size, int tx_buffer_size,
+                              int queue_size, void* uart_queue, int intr_alloc_flags) {
+    std::lock_guard<std::mutex> lock(uart_mutex);
+    if (uart_ports.count(uart_num)) {
+        return ESP_FAIL;
+    }
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        if (master >= 0) {
+            close(master);
+        }
+        return ESP_FAIL;
+    }
+    std::string path = ptsname(master);
+    int slave = open(path.c_str(), O_RDWR | O_NOCTTY);
+    if (slave >= 0) {
+        // bytes pass unchanged, as on a real UART
+        struct termios mode;
+        tcgetattr(slave, &mode);
+        cfmakeraw(&mode);
+        tcsetattr(slave, TCSANOW, &mode);
+    }
+    uart_ports[uart_num] = {master, slave, path};
+    std::cout << "uart: port " << uart_num << " is " << path << std::endl;
+    return ESP_OK;
+}
+
+esp_err_t uart_param_config(uart_port_t uart_num, const uart_config_t* uart_config) {
+    return ESP_OK;
+}
+
+esp_err_t uart_set_pin(uart_port_t uart_num, int tx_io_num, int rx_io_num, int rts_io_num, int cts_io_num) {
+    return ESP_OK;
+}
+
+int uart_read_bytes(uart_port_t uart_num, void* buf, uint32_t length, TickType_t ticks_to_wait) {
+    int master = uart_master(uart_num);
+    if (master < 0) {
+        return -1;
+    }
+    struct pollfd ready = {master, POLLIN, 0};
+    int timeout = ticks_to_wait == portMAX_DELAY ? -1 : static_cast<int>(ticks_to_wait);
+    if (poll(&ready, 1, timeout) <= 0) {
+        return 0;
+    }
+    ssize_t received = read(master, buf, length);
+    return received < 0 ? -1 : static_cast<int>(received);
+}
+
+esp_err_t uart_get_buffered_data_len(uart_port_t uart_num, size_t* size) {
+    int master = uart_master(uart_num);
+    int available = 0;
+    if (master < 0 || ioctl(master, FIONREAD, &available) != 0) {
+        return ESP_FAIL;
+    }
+    *size = available;
+    return ESP_OK;
+}
+
+esp_err_t uart_flush(uart_port_t uart_num) {
+    int master = uart_master(uart_num);
+    if (master < 0) {
+        return ESP_FAIL;
+    }
+    tcflush(master, TCIFLUSH);
+    return ESP_OK;
+}
+
+const char* puara_host_uart_path(uart_port_t uart_num) {
+    std::lock_guard<std::mutex> lock(uart_mutex);
+    auto port = uart_ports.find(uart_num);
+    return port == uart_ports.end() ? nullptr : port->second.path.c_str();
+}
@@ -0,0 +1,80 @@
+// Shared by the host tests: checks, a scratch SPIFFS directory and the
+// default data files. Each test defines PuaraTest::run(), which puara.h
+// lets read the module's internals.
+#ifndef PUARA_TEST_H
+#define PUARA_TEST_H
+
+#include <puara.h>
+#include <puara_host.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+class PuaraTest {
+    public:
+        static void run();
+        static int failures;
+};
+
+int PuaraTest::failures = 0;
+
+#define CHECK(condition) do { \
+        if (!(condition)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            PuaraTest::failures++; \
+        } \
+    } while (0)
+
+#define CHECK_EQUAL(actual, expected) do { \
+        auto actual_value_ = (actual); \
+        auto expected_value_ = (expected); \
+        if (!(actual_value_ == expected_value_)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " #actual " is " << actual_value_ \
+                      << ", expected " << expected_value_ << std::endl; \
+            PuaraTest::failures++; \
+        } \
+    } while (0)
+
+// A fresh SPIFFS directory for this process, removed at exit
+inline std::string test_spiffs_directory() {
+    static std::string directory;
+    if (directory.empty()) {
+        Puara::config_spiffs(); // as Puara::start() does
+        char path[] = "/tmp/puara_host_XXXXXX";
+        directory = mkdtemp(path);
+        puara_host_spiffs_directory(directory);
+        atexit([] { std::string command = "rm -rf " + directory; (void) system(command.c_str()); });
+    }
+    return directory;
+}
+
+inline std::string read_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    return contents.str();
+}
+
+// data/config.json and the other files shipped in the repository
+inline std::string data_file(const std::string& name) {
+    const char* directory = getenv("PUARA_HOST_DATA");
+    return read_file(std::string(directory ? directory : "data") + "/" + name);
+}
+
+int main() {
+    if (getenv("PUARA_HOST_VERBOSE") == nullptr) {
+        // the module's progress messages, checks report on stderr
+        (void) freopen("/dev/null", "w", stdout);
+    }
+    PuaraTest::run();
+    if (PuaraTest::failures) {
+        std::cerr << PuaraTest::failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,166 @@
+// Form bodies decode the same however the request is split into chunks,
+// including inside percent escapes, and random bodies decode as a
+// whole-body reference decoder reads them.
+
+#include "puara_test.h"
+#include <random>
+#include <utility>
+#include <vector>
+
+typedef std::vector<std::pair<std::string, std::string>> formFields;
+
+static void collect_field(void* context, std::string_view key, std::string_view value) {
+    static_cast<formFields*>(context)->emplace_back(std::string(key), std::string(value));
+}
+
+static std::string describe(const formFields& fields) {
+    std::string text;
+    for (const auto& field : fields) {
+        text += "[" + field.first + "=" + field.second + "]";
+    }
+    return text;
+}
+
+static std::string reference_unescape(const std::string& text) {
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '+') {
+            out += ' ';
+        } else if (text[i] == '%' && i + 2 < text.size() && isxdigit(static_cast<unsigned char>(text[i + 1])) &&
+                   isxdigit(static_cast<unsigned char>(text[i + 2]))) {
+            out += static_cast<char>(std::stoi(text.substr(i + 1, 2), nullptr, 16));
+            i += 2;
+        } else {
+            out += text[i];
+        }
+    }
+    return out;
+}
+
+// Split on '&', then on the first '=', then unescape each side
+static std::string reference_decode(const std::string& body) {
+    formFields fields;
+    size_t start = 0;
+    while (start <= body.size()) {
+        size_t end = body.find('&', start);
+        if (end == std::string::npos) {
+            end = body.size();
+        }
+        std::string field = body.substr(start, end - start);
+        size_t equals = field.find('=');
+        std::string key = reference_unescape(field.substr(0, equals));
+        std::string value = equals == std::string::npos ? std::string() : reference_unescape(field.substr(equals + 1));
+        if (!key.empty() || !value.empty()) {
+            if (key.size() + value.size() <= PUARA_FORM_FIELD_SIZE) {
+                fields.emplace_back(key, value);
+            }
+        }
+        start = end + 1;
+    }
+    return describe(fields);
+}
+
+void PuaraTest::run() {
+    const std::string body = "ssid=My+Network%21&psk=a%3Db%26c%25&bad=100%&half=%4&"
+                             "plain=x=y&&empty=&%E2%82%ACuro=%e2%82%ac&last=%41%42";
+    const std::string expected =
+        "[ssid=My Network!][psk=a=b&c%][bad=100%][half=%4][plain=x=y][empty=][\xE2\x82\xAC" "uro=\xE2\x82\xAC][last=AB]";
+
+    auto decode = [](const std::vector<std::string>& pieces) {
+        formFields fields;
+        Puara::formDecoder form;
+        form.begin(collect_field, &fields);
+        for (const std::string& piece : pieces) {
+            form.feed(piece.data(), piece.size());
+        }
+        form.finish();
+        return describe(fields);
+    };
+
+    CHECK_EQUAL(decode({body}), expected);
+    for (size_t i = 0; i <= body.size(); i++) {
+        for (size_t j = i; j <= body.size(); j++) {
+            CHECK_EQUAL(decode({body.substr(0, i), body.substr(i, j - i), body.substr(j)}), expected);
+        }
+    }
+    std::vector<std::string> bytes;
+    for (char c : body) {
+        bytes.push_back(std::string(1, c));
+    }
+    CHECK_EQUAL(decode(bytes), expected);
+
+    // Fields up to PUARA_FORM_FIELD_SIZE bytes arrive whole. A longer one is
+    // listed by name, the following ones still arrive.
+    std::string long_value(PUARA_FORM_FIELD_SIZE, 'v');
+    CHECK_EQUAL(decode({"long=" + long_value.substr(0, 300)}), "[long=" + long_value.substr(0, 300) + "]");
+    CHECK_EQUAL(decode({"long=" + long_value.substr(0, PUARA_FORM_FIELD_SIZE - 4)}),
+                "[long=" + long_value.substr(0, PUARA_FORM_FIELD_SIZE - 4) + "]");
+    {
+        formFields fields;
+        Puara::formDecoder form;
+        form.begin(collect_field, &fields);
+        std::string body = "a=1&long=" + long_value + "&b=2";
+        form.feed(body.data(), body.size());
+        form.finish();
+        CHECK_EQUAL(describe(fields), "[a=1][b=2]");
+        CHECK_EQUAL(form.too_long.size(), 1u);
+        CHECK_EQUAL(form.too_long.front(), "long");
+    }
+
+    // Random bodies in random chunks of 1 to 7 bytes
+    std::mt19937 random(2024);
+    const char alphabet[] = "ab=&%+4Fz\xC3\xA9";
+    for (int round = 0; round < 20000; round++) {
+        std::string random_body(random() % 40, ' ');
+        for (char& c : random_body) {
+            c = alphabet[random() % (sizeof(alphabet) - 1)];
+        }
+        std::vector<std::string> pieces;
+        for (size_t offset = 0; offset < random_body.size();) {
+            size_t size = 1 + random() % 7;
+            pieces.push_back(random_body.substr(offset, size));
+            offset += size;
+        }
+        std::string decoded = decode(pieces);
+        std::string expected_fields = reference_decode(random_body);
+        if (decoded != expected_fields) {
+            CHECK_EQUAL(decoded, expected_fields);
+            std::cerr << "body: " << random_body << std::endl;
+            break;
+        }
+    }
+
+    // The settings page posts through httpd_req_recv() in whatever chunks arrive
+    test_spiffs_directory();
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    const std::string post = "Hitchhiker=Arthur+Dent%21&answer_to_everything=4%32&variable3=-0.5&unknown=1";
+    for (size_t chunk = 1; chunk <= post.size(); chunk++) {
+        Puara::read_settings_json_internal(data_file("settings.json"));
+        puaraHostResponse response = puara_host_request(Puara::settings_post_handler, HTTP_POST, "/settings",
+                                                        post, chunk);
+        CHECK_EQUAL(response.result, ESP_OK);
+        CHECK_EQUAL(response.status, "200 OK"); // the embedded saved.html
+        CHECK(!response.body.empty());
+        CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Arthur Dent!");
+        CHECK_EQUAL(Puara::getVarNumber("answer_to_everything"), 42);
+        CHECK_EQUAL(Puara::getVarNumber("variable3"), -0.5);
+    }
+
+    // The saved file holds the posted values
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    Puara::read_settings();
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Arthur Dent!");
+
+    // A long text setting is stored whole, a field past the limit is refused
+    // by name and nothing is applied
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    std::string long_post = "Hitchhiker=" + long_value.substr(0, 300) + "&variable3=2";
+    CHECK_EQUAL(puara_host_request(Puara::settings_post_handler, HTTP_POST, "/settings", long_post, 64).status,
+                "200 OK");
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), long_value.substr(0, 300));
+    puaraHostResponse refused = puara_host_request(Puara::settings_post_handler, HTTP_POST, "/settings",
+                                                   "variable3=3&Hitchhiker=" + long_value, 1024);
+    CHECK_EQUAL(refused.status, "400 Bad Request");
+    CHECK(refused.body.find("Form field too long: Hitchhiker") != std::string::npos);
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 2);
+}
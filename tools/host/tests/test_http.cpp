@@ -0,0 +1,174 @@
+// The web server end to end: start_webserver() on the loopback httpd, then
+// requests over a real TCP connection.
+
+#include "puara_test.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <thread>
+
+struct testResponse {
+    std::string status; // "200 OK"
+    std::string head;
+    std::string body;
+};
+
+// A connection to the server, or -1
+static int connect_server() {
+    int connection = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(puara_host_http_port());
+    if (connect(connection, (struct sockaddr*) &address, sizeof(address)) != 0) {
+        close(connection);
+        return -1;
+    }
+    return connection;
+}
+
+static testResponse http_request(const std::string& method, const std::string& uri,
+                                 const std::string& body = std::string(), const std::string& headers = std::string()) {
+    testResponse response;
+    int connection = connect_server();
+    if (connection < 0) {
+        return response;
+    }
+    std::string request = method + " " + uri + " HTTP/1.1\r\nHost: 127.0.0.1\r\n" + headers +
+                          "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+    send(connection, request.data(), request.size(), MSG_NOSIGNAL);
+    std::string reply;
+    char buffer[4096];
+    ssize_t length;
+    while ((length = recv(connection, buffer, sizeof(buffer), 0)) > 0) {
+        reply.append(buffer, length);
+    }
+    close(connection);
+
+    size_t head_end = reply.find("\r\n\r\n");
+    if (reply.compare(0, 9, "HTTP/1.1 ") != 0 || head_end == std::string::npos) {
+        return response;
+    }
+    response.status = reply.substr(9, reply.find("\r\n") - 9);
+    response.head = reply.substr(0, head_end);
+    response.body = reply.substr(head_end + 4);
+    return response;
+}
+
+static std::string header_value(const testResponse& response, const std::string& field) {
+    size_t start = response.head.find("\r\n" + field + ": ");
+    if (start == std::string::npos) {
+        return std::string();
+    }
+    start += field.size() + 4;
+    return response.head.substr(start, response.head.find("\r\n", start) - start);
+}
+
+void PuaraTest::run() {
+    test_spiffs_directory();
+    std::string config_json = data_file("config.json");
+    std::string settings_json = data_file("settings.json");
+    Puara::read_config_json_internal(config_json);
+    Puara::read_settings_json_internal(settings_json);
+    setenv("PUARA_HOST_HTTP_PORT", "0", 1); // any free port
+
+    CHECK(Puara::start_webserver() == nullptr); // no network yet
+    Puara::ApStarted = true;
+    CHECK(Puara::start_webserver() != nullptr);
+    CHECK(puara_host_http_port() != 0);
+
+    testResponse config = http_request("GET", "/api/config");
+    CHECK_EQUAL(config.status, "200 OK");
+    CHECK_EQUAL(header_value(config, "Content-Type"), "application/json");
+    CHECK(config.body.find("\"oscIP1\":\"192.168.4.2\"") != std::string::npos);
+    CHECK(config.body.find("APpasswd") == std::string::npos);
+
+    testResponse patched = http_request("PATCH", "/api/config",
+                                        "{\"oscIP1\": \"10.0.0.8\", \"oscPORT1\": 9100, \"oscDestinations\": \"10.0.0.9:9200/50\"}");
+    CHECK_EQUAL(patched.status, "200 OK");
+    CHECK(patched.body.find("\"oscIP1\":\"10.0.0.8\"") != std::string::npos);
+    CHECK_EQUAL(Puara::getIP1(), "10.0.0.8");
+    CHECK_EQUAL(Puara::getPORT1(), 9100u);
+    CHECK_EQUAL(http_request("PATCH", "/api/config", "{\"oscPORT1\": }").status, "400 Bad Request");
+
+    // If-None-Match entries are compared whole, never as substrings
+    CHECK(Puara::etag_listed("\"abc-1\"", "\"abc-1\""));
+    CHECK(Puara::etag_listed("\"x\" ,\t\"abc-1\"", "\"abc-1\""));
+    CHECK(Puara::etag_listed("W/\"abc-1\"", "\"abc-1\""));
+    CHECK(Puara::etag_listed("\"x\", *", "\"abc-1\""));
+    CHECK(!Puara::etag_listed("\"\"abc-1\"\"", "\"abc-1\""));
+    CHECK(!Puara::etag_listed("\"abc-1\"x", "\"abc-1\""));
+    CHECK(!Puara::etag_listed("abc-1", "\"abc-1\""));
+    CHECK(!Puara::etag_listed("\"*\"", "\"abc-1\""));
+    CHECK(!Puara::etag_listed(" , ", "\"abc-1\""));
+
+    // Rendered pages carry an ETag that changes with the config
+    testResponse index = http_request("GET", "/");
+    CHECK_EQUAL(index.status, "200 OK");
+    CHECK_EQUAL(header_value(index, "Cache-Control"), "no-cache");
+    CHECK(index.body.find("10.0.0.8") != std::string::npos);
+    CHECK(index.body.find("name=\"oscDestinations\"") != std::string::npos);
+    CHECK(index.body.find("10.0.0.9:9200/50") != std::string::npos);
+    CHECK(index.body.find("%CURRENTOSC1%") == std::string::npos);
+    std::string etag = header_value(index, "ETag");
+    CHECK(etag.size() > 2 && etag.front() == '"' && etag.back() == '"');
+    CHECK(etag.find("-" + std::to_string(Puara::config_generation.load()) + "\"") != std::string::npos);
+    CHECK_EQUAL(http_request("GET", "/", "", "If-None-Match: " + etag + "\r\n").status, "304 Not Modified");
+    CHECK_EQUAL(http_request("GET", "/", "", "If-None-Match: \"x\", W/" + etag + "\r\n").status, "304 Not Modified");
+    CHECK_EQUAL(http_request("GET", "/", "", "If-None-Match: *\r\n").status, "304 Not Modified");
+    CHECK_EQUAL(http_request("GET", "/", "", "If-None-Match: \"" + etag + "\"\r\n").status, "200 OK");
+    http_request("PATCH", "/api/config", "{\"oscPORT1\": 9200}");
+    CHECK_EQUAL(http_request("GET", "/", "", "If-None-Match: " + etag + "\r\n").status, "200 OK");
+
+    // Static files come gzipped from flash and may be cached
+    testResponse style = http_request("GET", "/style.css");
+    CHECK_EQUAL(style.status, "200 OK");
+    CHECK_EQUAL(header_value(style, "Content-Type"), "text/css");
+    CHECK_EQUAL(header_value(style, "Content-Encoding"), "gzip");
+    CHECK(header_value(style, "Cache-Control").find("max-age=") != std::string::npos);
+    CHECK_EQUAL(http_request("GET", "/style.css", "", "If-None-Match: " + header_value(style, "ETag") + "\r\n").status,
+                "304 Not Modified");
+
+    testResponse settings = http_request("POST", "/settings.html", "variable3=6.5&Hitchhiker=Trillian");
+    CHECK_EQUAL(settings.status, "200 OK");
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 6.5);
+    testResponse page = http_request("GET", "/settings.html");
+    CHECK_EQUAL(page.status, "200 OK");
+    CHECK(page.body.find("Trillian") != std::string::npos);
+    CHECK(http_request("GET", "/api/settings").body.find("6.5") != std::string::npos);
+
+    // Numbers on the settings page keep their magnitude and precision
+    http_request("POST", "/settings.html", "variable3=1e300&answer_to_everything=0.1");
+    page = http_request("GET", "/settings.html");
+    CHECK(page.body.find("1.0000000000000001e+300") != std::string::npos);
+    CHECK(page.body.find("0.10000000000000001") != std::string::npos);
+
+    // A client that stalls halfway through its form does not hold up other
+    // settings writers
+    const std::string form = "variable3=7.5&Hitchhiker=Marvin";
+    int slow = connect_server();
+    std::string head = "POST /settings.html HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Length: " +
+                       std::to_string(form.size()) + "\r\n\r\n" + form.substr(0, 10);
+    send(slow, head.data(), head.size(), MSG_NOSIGNAL);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::future<void> writer = std::async(std::launch::async, [] {
+        std::lock_guard<std::mutex> lock(Puara::settings_write_mutex);
+    });
+    CHECK(writer.wait_for(std::chrono::seconds(1)) == std::future_status::ready);
+    send(slow, form.data() + 10, form.size() - 10, MSG_NOSIGNAL);
+    char reply[256];
+    CHECK(recv(slow, reply, sizeof(reply), 0) > 0);
+    close(slow);
+    writer.wait();
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Marvin");
+
+    CHECK_EQUAL(http_request("GET", "/missing").status, "404 Not Found");
+    CHECK_EQUAL(http_request("DELETE", "/api/config").status, "404 Not Found");
+
+    Puara::stop_webserver();
+    CHECK_EQUAL(puara_host_http_port(), 0);
+}
@@ -0,0 +1,217 @@
+// The JSON reader reports the same events however the document is split,
+// including inside escapes and surrogate pairs, a document it rejects
+// leaves the config and settings as they were, and the JSON API takes its
+// body in chunks of any size.
+
+#include "puara_test.h"
+#include <vector>
+
+void PuaraTest::run() {
+    // Events are written out one per line
+    void (*record_event)(void*, const Puara::jsonEvent&) = [](void* context, const Puara::jsonEvent& event) {
+        static const char* const names[] = {"{", "}", "[", "]", "string", "number", "true", "false", "null"};
+        std::ostringstream line;
+        line.precision(17);
+        line << names[event.type] << " " << event.depth << " <" << event.key << ">";
+        if (event.type == Puara::JSON_STRING) {
+            line << " <" << event.text << ">";
+        } else if (event.type == Puara::JSON_NUMBER) {
+            line << " " << event.number;
+        }
+        *static_cast<std::string*>(context) += line.str() + "\n";
+    };
+
+    // The result of parsing pieces, or "error" if the reader rejected them
+    auto parse = [&](const std::vector<std::string>& pieces) {
+        std::string events;
+        Puara::jsonStream parser;
+        parser.begin(record_event, &events);
+        bool ok = true;
+        for (const std::string& piece : pieces) {
+            ok = parser.feed(piece.data(), piece.size()) && ok;
+        }
+        ok = parser.finish() && ok;
+        return ok ? events : std::string("error");
+    };
+    auto every_split = [&](const std::string& document, const std::string& expected) {
+        for (size_t i = 0; i <= document.size(); i++) {
+            for (size_t j = i; j <= document.size(); j++) {
+                CHECK_EQUAL(parse({document.substr(0, i), document.substr(i, j - i), document.substr(j)}), expected);
+            }
+        }
+    };
+
+    const std::string document = "{\"text\": \"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\", \"caf\\u00e9\": \"\\u20AC\\ud83d\\ude00\",\n"
+                                 " \"list\": [1, -2.5e3, 0.125, true, false, null, {}, []], \"nested\": {\"n\": {\"m\": \"\"}}}";
+    const std::string expected =
+        "{ 0 <>\n"
+        "string 1 <text> <a\"b\\c/d\b\f\n\r\t>\n"
+        "string 1 <caf\xC3\xA9> <\xE2\x82\xAC\xF0\x9F\x98\x80>\n"
+        "[ 1 <list>\n"
+        "number 2 <> 1\n"
+        "number 2 <> -2500\n"
+        "number 2 <> 0.125\n"
+        "true 2 <>\n"
+        "false 2 <>\n"
+        "null 2 <>\n"
+        "{ 2 <>\n"
+        "} 2 <>\n"
+        "[ 2 <>\n"
+        "] 2 <>\n"
+        "] 1 <>\n"
+        "{ 1 <nested>\n"
+        "{ 2 <n>\n"
+        "string 3 <m> <>\n"
+        "} 2 <>\n"
+        "} 1 <>\n"
+        "} 0 <>\n";
+    CHECK_EQUAL(parse({document}), expected);
+    every_split(document, expected);
+
+    // Malformed documents are rejected wherever they are split
+    const char* const malformed[] = {
+        "{\"a\": }", "{\"a\" 1}", "{\"a\": 1,}", "[1 2]", "{\"a\": \"\\x\"}", "{\"a\": \"\\u12G4\"}",
+        "{\"a\": tru}", "{\"a\": 1} 2", "{\"a\": [1}", "{\"a\": \"unterminated", ""
+    };
+    for (const char* text : malformed) {
+        every_split(text, "error");
+    }
+
+    // Strings are not cut short. One past PUARA_JSON_TOKEN_SIZE is flagged and
+    // the rest of the document still parses; a number that long is malformed.
+    const std::string long_text(PUARA_JSON_TOKEN_SIZE + 1, 'x');
+    CHECK_EQUAL(parse({"{\"a\": \"" + long_text.substr(0, 300) + "\"}"}),
+                "{ 0 <>\nstring 1 <a> <" + long_text.substr(0, 300) + ">\n} 0 <>\n");
+    {
+        std::vector<std::string> flagged;
+        Puara::jsonStream parser;
+        parser.begin([](void* context, const Puara::jsonEvent& event) {
+            if (event.too_long) {
+                static_cast<std::vector<std::string>*>(context)->emplace_back(event.key);
+            }
+        }, &flagged);
+        std::string text = "{\"a\": \"" + long_text + "\", \"b\": \"" + long_text.substr(1) + "\", \"" +
+                           long_text + "\": 1, \"c\": 2}";
+        CHECK(parser.feed(text.data(), text.size()));
+        CHECK(parser.finish());
+        CHECK_EQUAL(flagged.size(), 2u);
+        CHECK_EQUAL(flagged[0], "a");
+        CHECK_EQUAL(flagged[1].size(), static_cast<size_t>(PUARA_JSON_TOKEN_SIZE));
+    }
+    CHECK_EQUAL(parse({"[" + std::string(PUARA_JSON_TOKEN_SIZE + 1, '1') + "]"}), "error");
+
+    // Imported files keep every field but the oversized ones
+    test_spiffs_directory();
+    Puara::read_config_json_internal(data_file("config.json"));
+    Puara::read_config_json_internal("{\"author\": \"" + long_text + "\", \"oscIP1\": \"10.9.9.8\", "
+                                     "\"institution\": \"" + long_text.substr(0, 300) + "\"}");
+    CHECK_EQUAL(Puara::getIP1(), "10.9.9.8");
+    CHECK_EQUAL(Puara::author, "Edu Meneses");
+    CHECK_EQUAL(Puara::institution, long_text.substr(0, 300));
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"Hitchhiker\", \"value\": \"" + long_text + "\"}, "
+                                       "{\"name\": \"variable3\", \"value\": 3}]}", true);
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Ford");
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 3);
+
+    // A rejected document changes nothing, a new settings list replaces the old
+    Puara::read_config_json_internal(data_file("config.json"));
+    Puara::read_config_json_internal("{\"oscIP1\": \"10.9.9.9\", \"oscPORT1\": }");
+    CHECK_EQUAL(Puara::getIP1(), "192.168.4.2");
+    CHECK_EQUAL(Puara::getPORT1(), 8000u);
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"variable3\", \"value\": 1}, ");
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 12.345);
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"variable4\", \"value\": 4}]}");
+    CHECK_EQUAL(Puara::getVarNumber("variable4"), 4);
+    bool replaced = false;
+    try {
+        Puara::getVarNumber("variable3");
+    } catch (const std::out_of_range&) {
+        replaced = true;
+    }
+    CHECK(replaced);
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"Hitchhiker\", \"value\": \"Zaphod\"}]}", true);
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Zaphod");
+    CHECK_EQUAL(Puara::getVarNumber("variable4"), 4);
+
+    // The config API reads its body through httpd_req_recv() in any chunks
+    const std::string patch = "{\"oscIP1\": \"10.0.0.\\u0037\", \"oscPORT1\": 9001, \"wifiSSID\": \"Caf\\u00e9\"}";
+    for (size_t chunk = 1; chunk <= patch.size(); chunk += 7) {
+        Puara::read_config_json_internal(data_file("config.json"));
+        puaraHostResponse response = puara_host_request(Puara::api_config_put_handler, HTTP_PATCH, "/api/config",
+                                                        patch, chunk);
+        CHECK_EQUAL(response.result, ESP_OK);
+        CHECK_EQUAL(response.content_type, "application/json");
+        CHECK(response.body.find("\"oscIP1\":\"10.0.0.7\"") != std::string::npos);
+        CHECK_EQUAL(Puara::getIP1(), "10.0.0.7");
+        CHECK_EQUAL(Puara::getPORT1(), 9001u);
+        CHECK_EQUAL(Puara::wifiSSID, "Caf\xC3\xA9");
+    }
+
+    // Rejected requests change nothing
+    Puara::read_config_json_internal(data_file("config.json"));
+    const std::pair<const char*, const char*> rejected[] = {
+        {"{\"oscIP1\": \"10.9.9.9\", \"oscPORT1\": \"9001\"}", "Wrong type for config field: oscPORT1"},
+        {"{\"oscIP1\": \"10.9.9.9\", \"colour\": \"red\"}", "Unknown config field: colour"},
+        {"{\"oscIP1\": \"10.9.9.9\"", "Malformed JSON"},
+        {"{\"APpasswd\": \"short\", \"oscIP1\": \"10.9.9.9\"}", "APpasswd must be 8 to 63 characters"},
+        {"{\"oscIP1\": \"10.9.9.9\", \"oscPORT1\": 0}", "oscPORT1 must be a port from 1 to 65535"},
+        {"{\"oscIP1\": \"10.9.9.9\", \"oscPORT2\": 65536}", "oscPORT2 must be a port from 1 to 65535"},
+        {"{\"oscIP1\": \"10.9.9.9\", \"localPORT\": 8000.5}", "localPORT must be a port from 1 to 65535"},
+        {"{\"oscIP1\": \"10.9.9\"}", "oscIP1 must be an IPv4 address"},
+        {"{\"oscIP1\": \"10.9.9.9\", \"oscIP2\": \"host.local\"}", "oscIP2 must be an IPv4 address"},
+        {"{\"oscIP1\": \"10.9.9.9.9\"}", "oscIP1 must be an IPv4 address"},
+    };
+    for (const auto& request : rejected) {
+        puaraHostResponse response = puara_host_request(Puara::api_config_put_handler, HTTP_PATCH, "/api/config",
+                                                        request.first, 1);
+        CHECK_EQUAL(response.result, ESP_FAIL);
+        CHECK_EQUAL(response.status, "400 Bad Request");
+        CHECK_EQUAL(response.body, request.second);
+        CHECK_EQUAL(Puara::getIP1(), "192.168.4.2");
+    }
+    puaraHostResponse long_password = puara_host_request(Puara::api_config_put_handler, HTTP_PATCH, "/api/config",
+                                                         "{\"APpasswd\": \"" + std::string(64, 'p') + "\"}");
+    CHECK_EQUAL(long_password.status, "400 Bad Request");
+    CHECK(puara_host_request(Puara::api_config_put_handler, HTTP_PATCH, "/api/config",
+                             "{\"APpasswd\": \"" + std::string(63, 'p') + "\"}").status == "200 OK");
+    CHECK_EQUAL(Puara::APpasswd, std::string(63, 'p'));
+
+    // GET leaves the passwords out, and a PUT of what it returned keeps them
+    Puara::read_config_json_internal(data_file("config.json"));
+    puaraHostResponse current = puara_host_request(Puara::api_config_get_handler, HTTP_GET, "/api/config");
+    CHECK(current.body.find("APpasswd") == std::string::npos);
+    CHECK(current.body.find("wifiPSK") == std::string::npos);
+    CHECK(current.body.find("mappings") == std::string::npos);
+    for (size_t i = 0; i < Puara::config_keys_count; i++) {
+        if (!Puara::config_keys[i].secret) {
+            CHECK(current.body.find("\"" + std::string(Puara::config_keys[i].name) + "\":") != std::string::npos);
+        }
+    }
+    CHECK_EQUAL(puara_host_request(Puara::api_config_put_handler, HTTP_PUT, "/api/config", current.body).status,
+                "200 OK");
+    CHECK_EQUAL(Puara::APpasswd, "mappings");
+    CHECK_EQUAL(Puara::wifiPSK, "AP_PASSWORD");
+    CHECK_EQUAL(puara_host_request(Puara::api_config_put_handler, HTTP_PATCH, "/api/config",
+                                   "{\"oscIP2\": \"\", \"localPORT\": 65535}").status, "200 OK");
+    CHECK_EQUAL(Puara::getIP2(), "");
+    CHECK_EQUAL(Puara::getLocalPORT(), 65535u);
+    Puara::read_config_json_internal(data_file("config.json"));
+    puaraHostResponse partial = puara_host_request(Puara::api_config_put_handler, HTTP_PUT, "/api/config",
+                                                   "{\"oscIP1\": \"10.9.9.9\"}", 1);
+    CHECK_EQUAL(partial.status, "400 Bad Request");
+    CHECK_EQUAL(Puara::getIP1(), "192.168.4.2");
+
+    // Settings PATCH only changes existing settings
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    puaraHostResponse settings = puara_host_request(Puara::api_settings_put_handler, HTTP_PATCH, "/api/settings",
+                                                    "{\"settings\": [{\"name\": \"variable3\", \"value\": 2.5}]}", 3);
+    CHECK_EQUAL(settings.result, ESP_OK);
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 2.5);
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Ford");
+    settings = puara_host_request(Puara::api_settings_put_handler, HTTP_PATCH, "/api/settings",
+                                  "{\"settings\": [{\"name\": \"variable4\", \"value\": 1}]}", 3);
+    CHECK_EQUAL(settings.status, "400 Bad Request");
+    CHECK_EQUAL(settings.body, "Unknown setting: variable4");
+}
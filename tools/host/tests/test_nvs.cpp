@@ -0,0 +1,78 @@
+// With PUARA_CONFIG_NVS the config moves from SPIFFS into NVS once, and a
+// store written by an older release keeps its values and gains the new keys.
+
+#include "puara_test.h"
+#include <nvs.h>
+
+static std::string nvs_text(const char* key) {
+    nvs_handle_t handle;
+    if (nvs_open(PUARA_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK) {
+        return "<no namespace>";
+    }
+    size_t length = 0;
+    std::string value = "<missing>";
+    if (nvs_get_str(handle, key, NULL, &length) == ESP_OK) {
+        value.resize(length);
+        nvs_get_str(handle, key, &value[0], &length);
+        value.resize(length - 1);
+    }
+    nvs_close(handle);
+    return value;
+}
+
+static uint32_t nvs_number(const char* key) {
+    nvs_handle_t handle;
+    uint32_t value = 0;
+    if (nvs_open(PUARA_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        nvs_get_u32(handle, key, &value);
+        nvs_close(handle);
+    }
+    return value;
+}
+
+void PuaraTest::run() {
+    test_spiffs_directory();
+    std::ofstream(puara_host_spiffs_path("/spiffs/config.json")) << data_file("config.json");
+
+    // First boot: nothing in NVS, config.json is imported and stored there
+    Puara::read_config();
+    CHECK_EQUAL(Puara::getIP1(), "192.168.4.2");
+    CHECK_EQUAL(nvs_text("oscIP1"), "192.168.4.2");
+    CHECK_EQUAL(nvs_number("schema"), Puara::nvs_schema);
+
+    // Later boots read NVS alone
+    unlink(puara_host_spiffs_path("/spiffs/config.json").c_str());
+    Puara::invalidate_asset("/spiffs/config.json");
+    Puara::oscIP1 = "unset";
+    Puara::read_config();
+    CHECK_EQUAL(Puara::getIP1(), "192.168.4.2");
+
+    // Saves go to NVS, and an unchanged config is not written again
+    Puara::oscIP1 = "10.0.0.9";
+    Puara::write_config();
+    CHECK_EQUAL(nvs_text("oscIP1"), "10.0.0.9");
+    CHECK(read_file(puara_host_spiffs_path("/spiffs/config.bin")).empty());
+
+    // A store from before oscDestinations and the schema key existed
+    puara_host_nvs_erase();
+    nvs_handle_t handle;
+    CHECK_EQUAL(nvs_open(PUARA_NVS_NAMESPACE, NVS_READWRITE, &handle), ESP_OK);
+    nvs_set_str(handle, "device", "Legacy");
+    nvs_set_u32(handle, "id", 7);
+    nvs_set_str(handle, "oscIP1", "10.1.1.1");
+    nvs_set_u32(handle, "oscPORT1", 7000);
+    nvs_commit(handle);
+    nvs_close(handle);
+    Puara::oscDestinations = "127.0.0.1:9000";
+    Puara::localPORT = 8000;
+    Puara::read_config();
+    CHECK_EQUAL(Puara::device, "Legacy");
+    CHECK_EQUAL(Puara::id, 7u);
+    CHECK_EQUAL(Puara::getIP1(), "10.1.1.1");
+    CHECK_EQUAL(Puara::getPORT1(), 7000u);
+    CHECK_EQUAL(Puara::oscDestinations, "127.0.0.1:9000"); // missing keys keep their default
+    CHECK_EQUAL(Puara::getLocalPORT(), 8000u);
+    CHECK_EQUAL(nvs_number("schema"), Puara::nvs_schema);
+    CHECK_EQUAL(nvs_text("oscDestinations"), "127.0.0.1:9000");
+    CHECK_EQUAL(nvs_text("device"), "Legacy");
+}
@@ -0,0 +1,489 @@
+// OSC over loopback: encoding, destinations changing under a sender, rate
+// limits and priorities, bundles and their deadline, address patterns and
+// settings written through /settings.
+
+#include "puara_test.h"
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+// A UDP socket on 127.0.0.1 standing in for an OSC receiver
+struct testReceiver {
+    int socket;
+    unsigned int port;
+
+    testReceiver() {
+        socket = ::socket(AF_INET, SOCK_DGRAM, 0);
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        bind(socket, (struct sockaddr*) &address, sizeof(address));
+        getsockname(socket, (struct sockaddr*) &address, &length);
+        port = ntohs(address.sin_port);
+    }
+    ~testReceiver() {
+        close(socket);
+    }
+    // The next packet, or "" if none arrives within timeout_ms
+    std::string receive(int timeout_ms = 500) {
+        struct pollfd ready = {socket, POLLIN, 0};
+        if (poll(&ready, 1, timeout_ms) <= 0) {
+            return std::string();
+        }
+        char packet[2048];
+        ssize_t length = recv(socket, packet, sizeof(packet), 0);
+        return std::string(packet, length > 0 ? length : 0);
+    }
+};
+
+// An OSC message built by hand: address, type tags and the encoded arguments
+static std::string osc_message(const std::string& address, const std::string& types, const std::string& arguments) {
+    auto padded = [](std::string text) {
+        text.resize((text.size() + 4) & ~static_cast<size_t>(3), '\0');
+        return text;
+    };
+    return padded(address) + padded("," + types) + arguments;
+}
+
+static std::string osc_bundle(const std::vector<std::string>& elements) {
+    std::string bundle("#bundle\0\0\0\0\0\0\0\0\1", 16);
+    for (const std::string& element : elements) {
+        uint32_t size = htonl(element.size());
+        bundle += std::string(reinterpret_cast<const char*>(&size), 4) + element;
+    }
+    return bundle;
+}
+
+static std::string big_endian_double(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    std::string bytes;
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        bytes += static_cast<char>(bits >> shift);
+    }
+    return bytes;
+}
+
+static std::vector<std::string> calls;
+
+static int open_descriptors() {
+    int count = 0;
+    DIR* directory = opendir("/proc/self/fd");
+    while (readdir(directory) != nullptr) {
+        count++;
+    }
+    closedir(directory);
+    return count;
+}
+
+static void record_call(const PuaraOSCMessage& message, void* context) {
+    calls.push_back(static_cast<const char*>(context));
+}
+
+void PuaraTest::run() {
+    test_spiffs_directory();
+
+    // Encoding: big-endian arguments after the padded address and tags
+    PuaraOSC message("/abc/accel", "ifhd");
+    message.set(0, 7);
+    message.set(1, 1.5f);
+    message.set(2, int64_t(-2));
+    message.set(3, 0.25);
+    const std::string encoded = osc_message("/abc/accel", "ifhd",
+        std::string("\0\0\0\7" "\x3f\xc0\0\0" "\xff\xff\xff\xff\xff\xff\xff\xfe", 16) + big_endian_double(0.25));
+    CHECK_EQUAL(encoded.size(), 44u);
+    CHECK_EQUAL(std::string(message.data(), message.size()), encoded);
+    CHECK(!PuaraOSC().begin("no/slash", "i"));
+    CHECK(!PuaraOSC().begin("/a", "x"));
+    CHECK(!PuaraOSC().begin("/a", std::string(PUARA_OSC_MAX_ARGS + 1, 'i').c_str()));
+    CHECK(!PuaraOSC().send(0));
+
+    // Sends go to oscIP1/oscPORT1 and oscIP2/oscPORT2
+    testReceiver first, second;
+    Puara::oscIP1 = "127.0.0.1";
+    Puara::oscPORT1 = first.port;
+    Puara::oscIP2 = "0.0.0.0";
+    Puara::oscPORT2 = second.port;
+    Puara::resolve_osc_destinations();
+    CHECK_EQUAL(Puara::osc_destinations[0].socket.load(), -1); // opened on the first send
+    CHECK(message.send(0));
+    CHECK(Puara::osc_destinations[0].socket.load() >= 0);
+    CHECK_EQUAL(first.receive(), encoded);
+    CHECK(!message.send(1));
+    CHECK(!Puara::send_osc(2, encoded.data(), encoded.size()));
+
+    // A config change takes effect once the destinations are resolved again
+    Puara::oscIP2 = "127.0.0.1";
+    Puara::resolve_osc_destinations();
+    CHECK(message.send());
+    CHECK_EQUAL(first.receive(), encoded);
+    CHECK_EQUAL(second.receive(), encoded);
+
+    // Setting an argument patches its slot and leaves the rest alone
+    message.set(0, -1);
+    CHECK(message.send(1));
+    std::string patched = encoded;
+    patched.replace(20, 4, std::string(4, '\xff'));
+    CHECK_EQUAL(second.receive(), patched);
+
+    // Destinations swapped while another task sends: every datagram reaches
+    // one of them intact
+    message.set(0, 7);
+    std::atomic<bool> sending(true);
+    std::atomic<int> sent(0);
+    std::thread sender([&] {
+        while (sending) {
+            sent += message.send(0) ? 1 : 0;
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+        }
+    });
+    int received = 0;
+    auto drain = [&](testReceiver& receiver, int timeout_ms) {
+        for (std::string datagram = receiver.receive(timeout_ms); !datagram.empty();
+             datagram = receiver.receive(timeout_ms)) {
+            CHECK_EQUAL(datagram, encoded);
+            received++;
+        }
+    };
+    for (int swap = 0; swap < 2000 || sent < 1000; swap++) {
+        Puara::oscPORT1 = (swap % 2) ? second.port : first.port;
+        Puara::resolve_osc_destinations();
+        drain(first, 0);
+        drain(second, 0);
+    }
+    sending = false;
+    sender.join();
+    drain(first, 50);
+    drain(second, 50);
+    CHECK(sent >= 1000);
+    CHECK_EQUAL(received, sent.load());
+    Puara::oscPORT1 = first.port;
+    Puara::resolve_osc_destinations();
+
+    // Bundles: sent when the deadline passes, with every message since the
+    // first one; the timetag is left out of the comparison
+    message.set(0, 7);
+    Puara::oscStatistics before = Puara::get_osc_statistics();
+    Puara::set_osc_bundling(true, 20);
+    auto start = std::chrono::steady_clock::now();
+    CHECK(message.send(0));
+    CHECK(message.send(0));
+    CHECK(message.send(1));
+    std::string bundle = first.receive();
+    CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+    CHECK_EQUAL(bundle.substr(0, 8), std::string("#bundle\0", 8));
+    CHECK_EQUAL(bundle.substr(16), osc_bundle({encoded, encoded}).substr(16));
+    CHECK_EQUAL(second.receive().substr(16), osc_bundle({encoded}).substr(16));
+    Puara::oscStatistics after = Puara::get_osc_statistics();
+    CHECK_EQUAL(after.messages - before.messages, 3u);
+    CHECK_EQUAL(after.packets - before.packets, 2u);
+    CHECK_EQUAL(after.bytes - before.bytes, bundle.size() + 16 + 4 + encoded.size());
+
+    // Each destination's bundle keeps the deadline of its own first message
+    start = std::chrono::steady_clock::now();
+    CHECK(message.send(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK(message.send(1));
+    CHECK(!first.receive().empty());
+    CHECK(!second.receive().empty());
+    CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(30));
+
+    // flush_osc() sends right away, and a bundle never outgrows one datagram
+    CHECK(message.send(0));
+    Puara::flush_osc();
+    CHECK_EQUAL(first.receive(5).substr(16), osc_bundle({encoded}).substr(16));
+    const size_t per_bundle = (PUARA_OSC_BUNDLE_SIZE - 16) / (4 + encoded.size());
+    for (size_t i = 0; i < per_bundle + 1; i++) {
+        CHECK(message.send(0));
+    }
+    std::string full = first.receive(5);
+    CHECK(full.size() <= PUARA_OSC_BUNDLE_SIZE);
+    CHECK_EQUAL(full.size(), 16 + per_bundle * (4 + encoded.size()));
+    Puara::flush_osc();
+    CHECK_EQUAL(first.receive(5).substr(16), osc_bundle({encoded}).substr(16));
+
+    // A message too large to bundle goes out as it is, after what was
+    // queued before it
+    std::string large = osc_message("/large", "b", std::string("\0\0\x05\xdc", 4) + std::string(1500, 'x'));
+    CHECK(message.send(0));
+    CHECK(Puara::send_osc(0, large.data(), large.size()));
+    CHECK_EQUAL(first.receive(5).substr(16), osc_bundle({encoded}).substr(16));
+    CHECK_EQUAL(first.receive(5), large);
+
+    // Disabling bundle mode sends what is pending right away
+    CHECK(message.send(1));
+    Puara::set_osc_bundling(false);
+    CHECK_EQUAL(second.receive(5).substr(16), osc_bundle({encoded}).substr(16));
+    CHECK(message.send(1));
+    CHECK_EQUAL(second.receive(5), encoded);
+
+    // Further destinations: ip:port[/rate[/priority]] entries after oscIP1
+    // and oscIP2, with invalid ones skipped
+    testReceiver third;
+    const char* const invalid[] = {
+        "127.0.0.1", "127.0.0.1:", "127.0.0.1:-1", "127.0.0.1: 9000", "127.0.0.1:+9000", "127.0.0.1:70000",
+        "127.0.0.1:9000/", "127.0.0.1:9000/x", "127.0.0.1:9000/10/8", "127.0.0.1:9000/2000000",
+        "127.0.0.1:9000x", "localhost:9000", "0.0.0.0:9000", "127.0.0.1:99999999999999", "127.0.0.1:9000/10/1/1"
+    };
+    for (const char* entry : invalid) {
+        Puara::oscDestinations = entry;
+        Puara::resolve_osc_destinations();
+        CHECK_EQUAL(Puara::osc_destinations[2].route.load(), 0u);
+    }
+    Puara::oscDestinations = " 127.0.0.1:" + std::to_string(third.port) + "/100/3 , bad , 127.0.0.1:9/1000000";
+    Puara::resolve_osc_destinations();
+    CHECK(Puara::osc_destinations[2].route.load() != 0);
+    CHECK_EQUAL(Puara::osc_destinations[2].interval_us.load(), 10000u);
+    CHECK_EQUAL(Puara::osc_destinations[2].burst_us.load(), 9u * 10000u); // 100 ms worth
+    CHECK_EQUAL((Puara::osc_destinations[2].route.load() >> 8) & 0xff, 3u);
+    CHECK_EQUAL(Puara::osc_destinations[3].interval_us.load(), 1u);
+    CHECK_EQUAL(Puara::osc_destinations[4].route.load(), 0u);
+
+    // The rate limit lets the burst through and drops the excess
+    Puara::oscStatistics before_rate = Puara::get_osc_statistics();
+    int allowed = 0;
+    for (int i = 0; i < 50; i++) {
+        allowed += message.send(2) ? 1 : 0;
+    }
+    CHECK_EQUAL(allowed, 10);
+    CHECK_EQUAL(Puara::get_osc_statistics().dropped - before_rate.dropped, 40u);
+    while (!third.receive(50).empty()) {
+    }
+
+    // Congestion sheds one priority level per PUARA_OSC_SHED_MS and restores
+    // one per PUARA_OSC_RECOVER_MS; moving the timestamps back stands in for
+    // the time passing
+    Puara::oscDestinations = "127.0.0.1:" + std::to_string(third.port) + "/0/3";
+    Puara::resolve_osc_destinations();
+    auto go_back = [](std::atomic<int64_t>& stamp, int ms) {
+        stamp.store(stamp.load() - ms * 1000);
+    };
+    Puara::osc_shed_us.store(esp_timer_get_time() - PUARA_OSC_SHED_MS * 1000);
+    for (int level = 1; level <= 4; level++) {
+        Puara::osc_congestion(true);
+        Puara::osc_congestion(true);
+        CHECK_EQUAL(Puara::osc_shed_priority.load(), level);
+        go_back(Puara::osc_shed_us, PUARA_OSC_SHED_MS);
+    }
+    CHECK(!message.send(2));
+    CHECK(message.send(0));
+    CHECK_EQUAL(first.receive(), encoded);
+    go_back(Puara::osc_shed_us, PUARA_OSC_RECOVER_MS);
+    go_back(Puara::osc_failure_us, PUARA_OSC_RECOVER_MS);
+    Puara::osc_congestion(false);
+    CHECK_EQUAL(Puara::osc_shed_priority.load(), 3);
+    Puara::osc_congestion(false);
+    CHECK_EQUAL(Puara::osc_shed_priority.load(), 3);
+    CHECK(message.send(2));
+    CHECK_EQUAL(third.receive(), encoded);
+    Puara::osc_shed_priority.store(0);
+
+    // Entries past the last slot are ignored, and clearing the list removes them
+    Puara::oscDestinations.clear();
+    for (int i = 2; i < PUARA_OSC_DESTINATIONS + 2; i++) {
+        Puara::oscDestinations += "127.0.0.1:" + std::to_string(9000 + i) + ",";
+    }
+    Puara::resolve_osc_destinations();
+    CHECK(Puara::osc_destinations[PUARA_OSC_DESTINATIONS - 1].route.load() != 0);
+    CHECK(!Puara::send_osc(PUARA_OSC_DESTINATIONS, encoded.data(), encoded.size()));
+    Puara::oscDestinations.clear();
+    Puara::resolve_osc_destinations();
+    for (int i = 2; i < PUARA_OSC_DESTINATIONS; i++) {
+        CHECK_EQUAL(Puara::osc_destinations[i].route.load(), 0u);
+    }
+
+    // Changing or removing a destination closes its socket, also while
+    // another task is sending through it
+    int descriptors = open_descriptors();
+    std::atomic<bool> swapping{true};
+    std::thread traffic([&] {
+        while (swapping.load()) {
+            Puara::send_osc(2, encoded.data(), encoded.size());
+        }
+    });
+    for (int round = 0; round < 300; round++) {
+        Puara::oscDestinations = "127.0.0.1:" + std::to_string(9100 + round % 7);
+        Puara::resolve_osc_destinations();
+        CHECK(Puara::send_osc(2, encoded.data(), encoded.size()));
+    }
+    swapping.store(false);
+    traffic.join();
+    Puara::oscDestinations.clear();
+    Puara::resolve_osc_destinations();
+    CHECK_EQUAL(Puara::osc_destinations[2].socket.load(), -1);
+    CHECK_EQUAL(open_descriptors(), descriptors);
+
+    // Incoming addresses are matched against the registered ones, with patterns
+    const char* const addresses[] = {"/synth/1/freq", "/synth/1/gain", "/synth/2/freq", "/synth/10/freq", "/fx"};
+    for (const char* address : addresses) {
+        CHECK(Puara::register_osc_handler(address, record_call, const_cast<char*>(address)));
+    }
+    CHECK(!Puara::register_osc_handler("/synth/*", record_call));
+    CHECK(!Puara::register_osc_handler("synth", record_call));
+    const std::pair<const char*, const char*> dispatched[] = {
+        {"/synth/1/freq", "/synth/1/freq"},
+        {"/synth/*/freq", "/synth/1/freq /synth/10/freq /synth/2/freq"},
+        {"/synth/?/freq", "/synth/1/freq /synth/2/freq"},
+        {"/synth/[1-2]/freq", "/synth/1/freq /synth/2/freq"},
+        {"/synth/1/[f-g]*", "/synth/1/freq /synth/1/gain"},
+        {"/synth/[!1]/freq", "/synth/2/freq"},
+        {"/synth/{1,10}/freq", "/synth/1/freq /synth/10/freq"},
+        {"/synth/*1*/freq", "/synth/1/freq /synth/10/freq"},
+        {"/synth/**1*0*/*r*q", "/synth/10/freq"},
+        {"/synth/*{0,1}/{freq,gain}", "/synth/1/freq /synth/1/gain /synth/10/freq"},
+        {"/synth/{1,2}/*{e,a}*", "/synth/1/freq /synth/1/gain /synth/2/freq"},
+        {"/synth/*[!0-9]/freq", ""},
+        {"/synth/1", ""},
+        {"/fx/extra", ""},
+    };
+    for (const auto& test : dispatched) {
+        calls.clear();
+        std::string packet = osc_message(test.first, "i", std::string(4, '\0'));
+        CHECK(Puara::dispatch_osc_packet(&packet[0], packet.size(), 0));
+        std::string names;
+        for (const std::string& call : calls) {
+            names += (names.empty() ? "" : " ") + call;
+        }
+        CHECK_EQUAL(names, test.second);
+    }
+    // Stars do not backtrack into each other: this pattern took minutes
+    // when every * tried every split of the name
+    const std::string long_address = "/" + std::string(40, 'a');
+    CHECK(Puara::register_osc_handler(long_address.c_str(), record_call, const_cast<char*>("long")));
+    std::string stars = "/";
+    for (int i = 0; i < 24; i++) {
+        stars += "*a";
+    }
+    auto started = std::chrono::steady_clock::now();
+    calls.clear();
+    std::string starred = osc_message(stars + "*b", "", "");
+    CHECK(Puara::dispatch_osc_packet(&starred[0], starred.size(), 0));
+    CHECK(calls.empty());
+    starred = osc_message(stars + "*", "", "");
+    CHECK(Puara::dispatch_osc_packet(&starred[0], starred.size(), 0));
+    CHECK_EQUAL(calls.size(), 1u);
+    // and {} groups beyond PUARA_OSC_MAX_BRACES make a segment match nothing
+    calls.clear();
+    std::string braced = osc_message("/{a,aa}{a,aa}{a,aa}{a,aa}*b", "", "");
+    CHECK(Puara::dispatch_osc_packet(&braced[0], braced.size(), 0));
+    braced = osc_message("/{a,aa}{a,aa}{a,aa}{a,aa}*", "", "");
+    CHECK(Puara::dispatch_osc_packet(&braced[0], braced.size(), 0));
+    CHECK_EQUAL(calls.size(), 1u);
+    braced = osc_message("/{a,aa}{a,aa}{a,aa}{a,aa}{a,aa}*", "", "");
+    CHECK(Puara::dispatch_osc_packet(&braced[0], braced.size(), 0));
+    CHECK_EQUAL(calls.size(), 1u);
+    CHECK(std::chrono::steady_clock::now() - started < std::chrono::seconds(1));
+
+    calls.clear();
+    std::string packet = osc_bundle({osc_message("/fx", "", ""), osc_bundle({osc_message("/synth/2/freq", "", "")})});
+    CHECK(Puara::dispatch_osc_packet(&packet[0], packet.size(), 0));
+    CHECK_EQUAL(calls.size(), 2u);
+
+    // Malformed packets are dropped without reading past their end
+    const std::string malformed[] = {
+        std::string("/fx", 3), osc_message("/fx", "i", ""), osc_message("/fx", "s", "abcd"),
+        osc_message("/fx", "x", ""), osc_message("fx", "", ""), osc_message("/fx", "b", std::string("\0\0\0\x10", 4)),
+        osc_bundle({std::string("/fx\0", 4)}).substr(0, 22)
+    };
+    for (std::string bad : malformed) {
+        CHECK(!Puara::dispatch_osc_packet(&bad[0], bad.size(), 0));
+    }
+    // and random bytes behind a valid start, for the sanitizer builds
+    std::mt19937 random(2023);
+    const std::string starts[] = {"/synth/", "/fx\0,", "#bundle\0", "/settings/variable3\0,"};
+    for (int round = 0; round < 20000; round++) {
+        std::string datagram = starts[round % 4];
+        datagram.resize(datagram.size() + random() % 64);
+        for (size_t i = starts[round % 4].size(); i < datagram.size(); i++) {
+            datagram[i] = "\0\1/,*?[]{}!ifhdsSbTF"[random() % 21];
+        }
+        std::vector<char> copy(datagram.begin(), datagram.end());
+        Puara::dispatch_osc_packet(copy.data(), copy.size(), 0);
+    }
+
+    // Settings are /settings/<name>, written only with a matching type; only
+    // a bare /settings/save writes flash
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    Puara::register_osc_handler("/settings/save", Puara::osc_save_handler);
+    auto dispatch = [](std::string packet) {
+        std::lock_guard<std::mutex> lock(Puara::osc_nodes_mutex);
+        Puara::register_osc_settings();
+        return Puara::dispatch_osc_packet(&packet[0], packet.size(), 0);
+    };
+    CHECK(dispatch(osc_message("/settings/variable3", "d", big_endian_double(0.5))));
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 0.5);
+    CHECK(dispatch(osc_message("/settings/Hitchhiker", "s", std::string("Zaphod\0\0", 8))));
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Zaphod");
+    CHECK(dispatch(osc_message("/settings/Hitchhiker", "i", std::string("\0\0\0\1", 4))));
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Zaphod");
+    CHECK(dispatch(osc_bundle({osc_message("/settings/answer_to_everything", "i", std::string("\0\0\0\x2a", 4)),
+                               osc_message("/settings/variable3", "f", std::string("\x3f\x80\0\0", 4))})));
+    CHECK_EQUAL(Puara::getVarNumber("answer_to_everything"), 42);
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 1);
+    CHECK(dispatch(osc_message("/settings/*", "d", big_endian_double(3))));
+    CHECK_EQUAL(Puara::getVarNumber("answer_to_everything"), 3);
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Zaphod");
+
+    // A packet publishes its writes as one snapshot, the last write to a
+    // setting wins, and writes that change nothing publish nothing
+    unsigned int version = Puara::settings_current.load()->version;
+    std::vector<std::string> writes;
+    for (int i = 1; i <= 16; i++) {
+        writes.push_back(osc_message("/settings/variable3", "d", big_endian_double(i)));
+    }
+    writes.push_back(osc_message("/settings/Hitchhiker", "s", std::string("Arthur\0\0", 8)));
+    CHECK(dispatch(osc_bundle(writes)));
+    CHECK_EQUAL(Puara::settings_current.load()->version, version + 1);
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 16);
+    CHECK_EQUAL(Puara::getVarText("Hitchhiker"), "Arthur");
+    CHECK(dispatch(osc_bundle(writes)));
+    CHECK_EQUAL(Puara::settings_current.load()->version, version + 1);
+
+    // /settings/save in the same bundle saves the values written before it
+    struct stat info;
+    std::string record = puara_host_spiffs_path("/spiffs/settings.bin");
+    CHECK(stat(record.c_str(), &info) != 0);
+    CHECK(dispatch(osc_bundle({osc_message("/settings/variable3", "d", big_endian_double(7)),
+                               osc_message("/settings/save", "", "")})));
+    CHECK(stat(record.c_str(), &info) == 0);
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    Puara::read_settings();
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 7);
+
+    // The receiver task takes the same messages from localPORT, a free one
+    {
+        int probe = socket(AF_INET, SOCK_DGRAM, 0);
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        socklen_t length = sizeof(address);
+        bind(probe, (struct sockaddr*) &address, sizeof(address));
+        getsockname(probe, (struct sockaddr*) &address, &length);
+        Puara::localPORT = ntohs(address.sin_port);
+        close(probe);
+    }
+    Puara::start_osc_receiver();
+    CHECK(Puara::osc_receive_socket >= 0);
+    std::string update = osc_message("/settings/variable3", "f", std::string("\x40\x20\0\0", 4)); // 2.5
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    local.sin_port = htons(Puara::localPORT);
+    sendto(first.socket, update.data(), update.size(), 0, (struct sockaddr*) &local, sizeof(local));
+    for (int i = 0; i < 200 && Puara::getVarNumber("variable3") != 2.5; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 2.5);
+}
@@ -0,0 +1,191 @@
+// Config and settings records survive a write torn at any byte: the reader
+// keeps the previous record, or takes the complete temporary copy when the
+// device stopped between syncing it and renaming it over the old one. Saves
+// from the forms and the API are debounced into a single write, and the
+// JSON exports are never seen half written.
+
+#include "puara_test.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+static std::string spiffs(const std::string& name) {
+    return test_spiffs_directory() + "/" + name;
+}
+
+static void write_file(const std::string& name, const std::string& contents) {
+    std::ofstream(spiffs(name), std::ios::binary) << contents;
+}
+
+static void set_files(const std::string& bin, const std::string* new_record) {
+    unlink(spiffs("config.bin").c_str());
+    unlink(spiffs("config.new").c_str());
+    if (!bin.empty()) {
+        write_file("config.bin", bin);
+    }
+    if (new_record != nullptr) {
+        write_file("config.new", *new_record);
+    }
+}
+
+static std::atomic<bool> restarted(false);
+static std::string record_at_restart;
+
+void PuaraTest::run() {
+    // Reads the config as at boot and returns the oscIP1 it ended up with
+    auto boot_config = [] {
+        Puara::oscIP1 = "unset";
+        Puara::config_record_valid = false;
+        Puara::read_config();
+        return Puara::getIP1();
+    };
+
+    test_spiffs_directory();
+    write_file("config.json", data_file("config.json"));
+    write_file("settings.json", data_file("settings.json"));
+
+    // No record yet: config.json is imported and saved as config.bin
+    std::string json_ip = boot_config();
+    CHECK(json_ip != "unset");
+    std::string old_record = read_file(spiffs("config.bin"));
+    CHECK(!old_record.empty());
+
+    // The record that a save of a new oscIP1 writes
+    Puara::oscIP1 = "10.1.2.3";
+    Puara::write_config();
+    std::string new_record = read_file(spiffs("config.bin"));
+    CHECK(new_record != old_record);
+    CHECK(read_file(spiffs("config.new")).empty());
+
+    // Torn while writing config.new: the old record stays in force
+    for (size_t length = 0; length < new_record.size(); length++) {
+        std::string torn = new_record.substr(0, length);
+        set_files(old_record, &torn);
+        CHECK_EQUAL(boot_config(), json_ip);
+    }
+
+    // Synced but not renamed, before or after config.bin was removed
+    set_files(old_record, &new_record);
+    CHECK_EQUAL(boot_config(), "10.1.2.3");
+    set_files("", &new_record);
+    CHECK_EQUAL(boot_config(), "10.1.2.3");
+
+    // Any damaged byte of a record is caught by the header checks or the CRC
+    for (size_t offset = 0; offset < new_record.size(); offset++) {
+        std::string damaged = new_record;
+        damaged[offset] ^= 0x20;
+        set_files(damaged, nullptr);
+        CHECK_EQUAL(boot_config(), json_ip);
+    }
+
+    // Saving something unchanged leaves the file alone
+    set_files(new_record, nullptr);
+    CHECK_EQUAL(boot_config(), "10.1.2.3");
+    unlink(spiffs("config.bin").c_str());
+    Puara::write_config();
+    CHECK(read_file(spiffs("config.bin")).empty());
+
+    // Settings use the same scheme
+    Puara::read_settings();
+    std::string old_settings = read_file(spiffs("settings.bin"));
+    {
+        std::lock_guard<std::mutex> lock(Puara::settings_write_mutex);
+        std::unique_ptr<Puara::settingsSnapshot> next = Puara::copy_settings();
+        next->variables.numbers[next->variables.find("variable3")] = 0.5;
+        Puara::publish_settings(std::move(next), false);
+    }
+    Puara::write_settings();
+    std::string new_settings = read_file(spiffs("settings.bin"));
+    CHECK(new_settings != old_settings);
+    for (size_t length = 0; length < new_settings.size(); length++) {
+        unlink(spiffs("settings.bin").c_str());
+        write_file("settings.bin", old_settings);
+        write_file("settings.new", new_settings.substr(0, length));
+        Puara::read_settings();
+        CHECK_EQUAL(Puara::getVarNumber("variable3"), 12.345);
+    }
+    write_file("settings.new", new_settings);
+    Puara::read_settings();
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 0.5);
+
+    // A burst of saves is written once, after PUARA_SAVE_DELAY_MS of quiet
+    xTaskCreate(Puara::persist_changes, "persist_changes", 4096, NULL, 1, &Puara::persistence_task);
+    unlink(spiffs("config.bin").c_str());
+    for (int i = 0; i < 5; i++) {
+        Puara::oscIP1 = "10.1.2." + std::to_string(10 + i);
+        Puara::save_config();
+        std::this_thread::sleep_for(std::chrono::milliseconds(PUARA_SAVE_DELAY_MS / 10));
+    }
+    CHECK(read_file(spiffs("config.bin")).empty());
+    std::this_thread::sleep_for(std::chrono::milliseconds(PUARA_SAVE_DELAY_MS * 2));
+    CHECK(read_file(spiffs("config.bin")).find("10.1.2.14") != std::string::npos);
+
+    // Config posted and shown by the web server task while the persistence
+    // task saves it and serial transfers change it, for the TSan build
+    Puara::compile_templates();
+    std::thread poster([] {
+        for (int i = 0; i < 200; i++) {
+            std::string ip = "10.2.0." + std::to_string(i % 100);
+            puara_host_request(Puara::api_config_put_handler, HTTP_PATCH, "/api/config",
+                               "{\"oscIP1\": \"" + ip + "\"}");
+            puara_host_request(Puara::index_post_handler, HTTP_POST, "/", "oscIP2=" + ip);
+            puara_host_request(Puara::index_get_handler, HTTP_GET, "/");
+        }
+    });
+    for (int i = 0; i < 200; i++) {
+        Puara::write_config();
+        Puara::read_config_json_internal("{\"author\": \"Serial " + std::to_string(i) + "\"}");
+    }
+    poster.join();
+    Puara::write_config();
+    CHECK(read_file(spiffs("config.bin")).find("10.2.0.99") != std::string::npos);
+    CHECK_EQUAL(Puara::getIP1(), "10.2.0.99");
+    CHECK_EQUAL(Puara::getIP2(), "10.2.0.99");
+
+    // The JSON exports replace the file whole, a reader never finds one cut
+    // short. An export left before its rename is read back.
+    std::atomic<bool> exporting(true);
+    std::atomic<int> torn_exports(0);
+    std::thread export_reader([&] {
+        while (exporting) {
+            std::ifstream in(spiffs("config.json"), std::ios::binary);
+            std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            size_t end = contents.find_last_not_of(" \n");
+            if (in.is_open() && (end == std::string::npos || contents[end] != '}')) {
+                torn_exports++;
+            }
+        }
+    });
+    for (int i = 0; i < 300; i++) {
+        Puara::write_config_json();
+    }
+    exporting = false;
+    export_reader.join();
+    CHECK_EQUAL(torn_exports.load(), 0);
+    CHECK(read_file(spiffs("config.json")).find("\"oscIP1\":\"10.2.0.99\"") != std::string::npos);
+    CHECK(access(spiffs("config.json.new").c_str(), F_OK) != 0);
+    rename(spiffs("config.json").c_str(), spiffs("config.json.new").c_str());
+    Puara::invalidate_asset("/spiffs/config.json");
+    Puara::oscIP1 = "unset";
+    Puara::read_config_json();
+    CHECK_EQUAL(Puara::getIP1(), "10.2.0.99");
+    Puara::write_settings_json();
+    CHECK(read_file(spiffs("settings.json")).find("{\"settings\":[") == 0);
+
+    // A reboot writes what is pending first, even while saves keep arriving
+    puara_host_on_restart([] {
+        record_at_restart = read_file(spiffs("config.bin"));
+        restarted = true;
+    });
+    unlink(spiffs("config.bin").c_str());
+    Puara::oscIP1 = "10.9.9.9";
+    Puara::save_config();
+    Puara::reboot_command("");
+    auto start = std::chrono::steady_clock::now();
+    while (!restarted && std::chrono::steady_clock::now() - start < std::chrono::milliseconds(PUARA_SAVE_MAX_DELAY_MS)) {
+        Puara::save_config();
+        std::this_thread::sleep_for(std::chrono::milliseconds(PUARA_SAVE_DELAY_MS / 5));
+    }
+    CHECK(restarted);
+    CHECK(record_at_restart.find("10.9.9.9") != std::string::npos);
+}
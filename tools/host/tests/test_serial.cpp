@@ -0,0 +1,86 @@
+// Serial input is framed into commands by line, JSON payloads may span
+// lines, firmware commands are dispatched with their arguments, and framed
+// sendconfig/sendsettings transfers are applied only when complete.
+
+#include "puara_test.h"
+#include <vector>
+
+static std::vector<std::string> received;
+
+static void record_command(std::string_view arguments) {
+    received.emplace_back(arguments);
+}
+
+void PuaraTest::run() {
+    CHECK(Puara::register_serial_command("record", record_command));
+    CHECK(!Puara::register_serial_command("record", record_command)); // taken
+    CHECK(!Puara::register_serial_command("ping", record_command));   // built in
+    CHECK(!Puara::register_serial_command("", record_command));
+
+    // Arguments arrive trimmed, whatever the chunking
+    const std::string input = "record  one two\r\nrecord\nunknown command\nrecord {\"a\":\n \"b\\n}\"}\n";
+    for (size_t chunk = 1; chunk <= input.size(); chunk++) {
+        received.clear();
+        for (size_t offset = 0; offset < input.size(); offset += chunk) {
+            Puara::frame_serial(input.data() + offset, std::min(chunk, input.size() - offset));
+        }
+        CHECK_EQUAL(received.size(), 3u);
+        if (received.size() == 3) {
+            CHECK_EQUAL(received[0], "one two");
+            CHECK_EQUAL(received[1], "");
+            CHECK_EQUAL(received[2], "{\"a\":\n \"b\\n}\"}");
+        }
+    }
+
+    // Built-in commands are found by name only
+    CHECK(Puara::find_serial_command("ping") != nullptr);
+    CHECK(Puara::find_serial_command("pin") == nullptr);
+    CHECK(Puara::find_serial_command("pingg") == nullptr);
+    CHECK(Puara::find_serial_command("") == nullptr);
+
+    // Framed transfers answer on the serial output, std::cout, after the
+    // module's own messages
+    test_spiffs_directory();
+    Puara::read_config_json_internal(data_file("config.json"));
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    std::ostringstream replies;
+    std::streambuf* output = std::cout.rdbuf(replies.rdbuf());
+    auto transfer = [&](const std::string& command, const std::string& payload, uint32_t crc, size_t chunk) {
+        char header[64];
+        snprintf(header, sizeof(header), " <<<%zu %08x\n", payload.size(), (unsigned int) crc);
+        const std::string framed = command + header + payload + ">>>";
+        replies.str("");
+        for (size_t offset = 0; offset < framed.size(); offset += chunk) {
+            Puara::frame_serial(framed.data() + offset, std::min(chunk, framed.size() - offset));
+        }
+        std::string output = replies.str();
+        return output.substr(std::min(output.rfind("<<<"), output.size()));
+    };
+    std::string settings = "{\"settings\": [{\"name\": \"variable3\",\n \"value\": 0.5}, "
+                           "{\"name\": \"Hitchhiker\", \"value\": \"" + std::string(300, 'x') + "\"}]}";
+    uint32_t crc = Puara::crc32(0, settings.data(), settings.size());
+    char ack[32];
+    snprintf(ack, sizeof(ack), "<<<ACK %08x>>>\n", (unsigned int) crc);
+    for (size_t chunk : {1, 7, 128, 4096}) {
+        Puara::read_settings_json_internal(data_file("settings.json"));
+        CHECK_EQUAL(transfer("sendsettings", settings, crc, chunk), ack);
+        CHECK_EQUAL(Puara::getVarNumber("variable3"), 0.5);
+        CHECK_EQUAL(Puara::getVarText("Hitchhiker").size(), 300u);
+    }
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    CHECK_EQUAL(transfer("sendsettings", settings, crc ^ 1, 128), "<<<NAK crc mismatch>>>\n");
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 12.345);
+    std::string oversized = "{\"settings\": [{\"name\": \"variable3\", \"value\": 0.5}, {\"name\": \"Hitchhiker\", "
+                            "\"value\": \"" + std::string(PUARA_JSON_TOKEN_SIZE + 1, 'x') + "\"}]}";
+    CHECK_EQUAL(transfer("sendsettings", oversized, Puara::crc32(0, oversized.data(), oversized.size()), 4096),
+                "<<<NAK too long: Hitchhiker>>>\n");
+    CHECK_EQUAL(Puara::getVarNumber("variable3"), 12.345);
+    std::string broken = "{\"oscIP1\": \"10.0.0.1\",}";
+    CHECK_EQUAL(transfer("sendconfig", broken, Puara::crc32(0, broken.data(), broken.size()), 128),
+                "<<<NAK invalid json>>>\n");
+    CHECK_EQUAL(Puara::getIP1(), "192.168.4.2");
+    std::string config = "{\"oscIP1\": \"10.0.0.1\"}";
+    transfer("sendconfig", config, Puara::crc32(0, config.data(), config.size()), 3);
+    CHECK_EQUAL(Puara::getIP1(), "10.0.0.1");
+    std::cout.rdbuf(output);
+}
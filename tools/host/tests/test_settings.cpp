@@ -0,0 +1,112 @@
+// Setting handles resolve their name once, follow layout changes and
+// report modifications through the settings version. Subscribers get one
+// batch of changed names per update.
+
+#include "puara_test.h"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static std::mutex batches_mutex;
+static std::vector<std::vector<std::string>> batches;
+
+static void record_batch(const std::vector<std::string>& changed_settings) {
+    std::lock_guard<std::mutex> lock(batches_mutex);
+    batches.push_back(changed_settings);
+}
+
+// The batches delivered so far, once the notifier task has been quiet a while
+static std::vector<std::vector<std::string>> delivered_batches() {
+    size_t count = SIZE_MAX;
+    for (int i = 0; i < 100; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::lock_guard<std::mutex> lock(batches_mutex);
+        if (batches.size() == count) {
+            break;
+        }
+        count = batches.size();
+    }
+    std::lock_guard<std::mutex> lock(batches_mutex);
+    std::vector<std::vector<std::string>> delivered;
+    delivered.swap(batches);
+    return delivered;
+}
+
+void PuaraTest::run() {
+    test_spiffs_directory();
+    Puara::read_settings_json_internal(data_file("settings.json"));
+
+    SettingHandle<double> answer("answer_to_everything");
+    SettingHandle<std::string> hitchhiker("Hitchhiker");
+    SettingHandle<double> wrong_type("Hitchhiker");
+    SettingHandle<double> missing("variable4");
+    CHECK(answer.valid());
+    CHECK_EQUAL(answer.get(), 42);
+    CHECK_EQUAL(hitchhiker.get(), "Ford");
+    CHECK(!wrong_type.valid());
+    CHECK_EQUAL(wrong_type.get(), 0);
+    CHECK(!missing.valid());
+    CHECK(!answer.changed());
+
+    // The name index finds every setting whatever order they were added in,
+    // and survives a copy of the store
+    Puara::settingsStore store;
+    const char* const names[] = {"b", "ab", "a", "abc", "B", "", "b2"};
+    for (const char* name : names) {
+        store.add(name, Puara::SETTING_NUMBER);
+    }
+    Puara::settingsStore copy = store;
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        CHECK_EQUAL(store.find(names[i]), static_cast<int>(i));
+        CHECK_EQUAL(copy.find(names[i]), static_cast<int>(i));
+    }
+    CHECK_EQUAL(store.find("abcd"), -1);
+    CHECK_EQUAL(store.find("c"), -1);
+    store.clear();
+    CHECK_EQUAL(store.find("a"), -1);
+
+    // A value change is seen once, by every handle
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"answer_to_everything\", \"value\": 43}]}", true);
+    CHECK(answer.changed());
+    CHECK(!answer.changed());
+    CHECK(hitchhiker.changed());
+    CHECK_EQUAL(answer.get(), 43);
+
+    // A new layout moves the slots, handles look their name up again
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"variable4\", \"value\": 4}, "
+                                       "{\"name\": \"answer_to_everything\", \"value\": 44}]}");
+    CHECK(missing.valid());
+    CHECK_EQUAL(missing.get(), 4);
+    CHECK_EQUAL(answer.get(), 44);
+    CHECK(!hitchhiker.valid());
+    CHECK_EQUAL(hitchhiker.get(), "");
+    CHECK_EQUAL(Puara::getVarNumber("answer_to_everything"), 44);
+
+    // One update is one batch with every changed name, unchanged ones left out
+    Puara::read_settings_json_internal(data_file("settings.json"));
+    int subscription = Puara::subscribe_settings(record_batch);
+    CHECK(subscription >= 0);
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"answer_to_everything\", \"value\": 41}, "
+                                       "{\"name\": \"variable3\", \"value\": 12.345}, "
+                                       "{\"name\": \"Hitchhiker\", \"value\": \"Arthur\"}]}", true);
+    std::vector<std::vector<std::string>> delivered = delivered_batches();
+    CHECK_EQUAL(delivered.size(), 1u);
+    if (delivered.size() == 1) {
+        std::vector<std::string> names = delivered[0];
+        std::sort(names.begin(), names.end());
+        CHECK(names == std::vector<std::string>({"Hitchhiker", "answer_to_everything"}));
+    }
+
+    // Removed settings are reported, and an unsubscribed callback hears nothing
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"Hitchhiker\", \"value\": \"Arthur\"}]}");
+    delivered = delivered_batches();
+    CHECK_EQUAL(delivered.size(), 1u);
+    if (delivered.size() == 1) {
+        CHECK_EQUAL(delivered[0].size(), 2u);
+    }
+    Puara::unsubscribe_settings(subscription);
+    Puara::read_settings_json_internal("{\"settings\": [{\"name\": \"Hitchhiker\", \"value\": \"Ford\"}]}", true);
+    CHECK(delivered_batches().empty());
+}
@@ -0,0 +1,110 @@
+// Readers under a settingsReadGuard always see one whole snapshot while
+// writers publish new values and new layouts as fast as they can.
+
+#include "puara_test.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static std::atomic<long> notified_batches{0};
+
+static void count_batch(const std::vector<std::string>& changed_settings) {
+    notified_batches++;
+}
+
+// Every number of a snapshot holds the same value and "tag" spells it
+static std::string settings_document(int count, long value) {
+    std::string document = "{\"settings\": [{\"name\": \"tag\", \"value\": \"" + std::to_string(value) + "\"}";
+    for (int i = 0; i < count; i++) {
+        document += ", {\"name\": \"number" + std::to_string(i) + "\", \"value\": " + std::to_string(value) + "}";
+    }
+    return document + "]}";
+}
+
+void PuaraTest::run() {
+    const auto duration = std::chrono::seconds(1);
+    const int readers = 4;
+    Puara::read_settings_json_internal(settings_document(8, 0));
+    Puara::subscribe_settings(count_batch);
+
+    std::atomic<bool> running{true};
+    std::atomic<long> reads{0};
+    std::atomic<long> torn{0};
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; r++) {
+        threads.emplace_back([&] {
+            SettingHandle<std::string> tag("tag");
+            while (running) {
+                // a handle's text is always a whole value, whichever snapshot it came from
+                const std::string& text = tag.get();
+                size_t digits = 0;
+                std::stol(text, &digits);
+                if (digits != text.size()) {
+                    torn++;
+                }
+                Puara::settingsReadGuard guard;
+                const Puara::settingsStore& variables = guard->variables;
+                unsigned int version = guard->version;
+                bool consistent = variables.size() == variables.name_index.size() && variables.size() > 1;
+                long value = 0;
+                for (size_t i = 0; consistent && i < variables.size(); i++) {
+                    if (variables.types[i] == Puara::SETTING_TEXT) {
+                        value = std::stol(std::string(variables.text(i)));
+                    }
+                    consistent = variables.find(variables.name(i)) == static_cast<int>(i);
+                }
+                for (size_t i = 0; consistent && i < variables.size(); i++) {
+                    consistent = variables.types[i] == Puara::SETTING_TEXT || variables.numbers[i] == value;
+                }
+                if (!consistent || guard->version != version) {
+                    torn++;
+                }
+                reads++;
+            }
+        });
+    }
+
+    // One writer changes values in place, the other changes the layout
+    std::atomic<long> value_updates{0};
+    std::atomic<long> layout_updates{0};
+    threads.emplace_back([&] {
+        for (long value = 1; running; value++) {
+            std::lock_guard<std::mutex> lock(Puara::settings_write_mutex);
+            std::unique_ptr<Puara::settingsSnapshot> next = Puara::copy_settings();
+            Puara::settingsStore& variables = next->variables;
+            for (size_t i = 0; i < variables.size(); i++) {
+                if (variables.types[i] == Puara::SETTING_TEXT) {
+                    variables.set_text(i, std::to_string(value));
+                } else {
+                    variables.numbers[i] = value;
+                }
+            }
+            Puara::publish_settings(std::move(next), false);
+            value_updates++;
+        }
+    });
+    threads.emplace_back([&] {
+        for (int count = 1; running; count = count % 40 + 1) {
+            Puara::read_settings_json_internal(settings_document(count, -count));
+            layout_updates++;
+        }
+    });
+
+    std::this_thread::sleep_for(duration);
+    running = false;
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    CHECK_EQUAL(torn.load(), 0);
+    CHECK(reads > 1000);
+    CHECK(value_updates > 10);
+    CHECK(layout_updates > 10);
+
+    // The last values are the ones a new reader sees, the notifier caught up
+    Puara::read_settings_json_internal(settings_document(2, 7));
+    CHECK_EQUAL(Puara::getVarText("tag"), "7");
+    CHECK_EQUAL(Puara::getVarNumber("number1"), 7);
+    CHECK(notified_batches > 0);
+}